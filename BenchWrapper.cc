@@ -0,0 +1,192 @@
+// BenchWrapper.cc
+
+#include "BenchWrapper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "BoardMove.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ChessBoardFactory.h"
+#include "ChessBoardUtilities.h"
+#include "Constants.h"
+#include "LevelFiveComputer.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+#include "PieceData.h"
+
+
+#pragma mark - BenchPosition
+
+/*
+ * Basic ctor
+ */
+BenchWrapper::BenchPosition::BenchPosition(std::string name, std::unique_ptr<ChessBoard> chessBoard) :
+    name(std::move(name)), chessBoard(std::move(chessBoard)) { }
+
+
+#pragma mark - BenchWrapper
+
+/*
+ * Basic ctor
+ */
+BenchWrapper::BenchWrapper(std::ostream &out, int searchDepth, int numThreads) :
+    out(out), searchDepth(searchDepth), numThreads(numThreads) {
+
+    assert(searchDepth > 0 && numThreads > 0);
+}
+
+/*
+ * Run the bench
+ * Positions are searched in parallel, each by its own LevelFiveComputer on its own copy of the ChessBoard,
+ * and reported in a fixed order so the output does not depend on the number of threads
+ */
+void BenchWrapper::runBench() {
+    std::vector<BenchPosition> benchPositions = createBenchPositions();
+    std::vector<BenchResult> benchResults(benchPositions.size());
+
+    // Search
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::atomic<int> nextBenchPositionIndex(0);
+    auto searchBenchPositions = [&]() {
+        for (int benchPositionIndex = nextBenchPositionIndex++; benchPositionIndex < static_cast<int>(benchPositions.size()); benchPositionIndex = nextBenchPositionIndex++) {
+            benchResults[benchPositionIndex] = searchBenchPosition(benchPositions[benchPositionIndex]);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int threadIndex = 1; threadIndex < std::min(numThreads, static_cast<int>(benchPositions.size())); ++threadIndex) {
+        threads.emplace_back(searchBenchPositions);
+    }
+    searchBenchPositions();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    std::chrono::nanoseconds totalTime = std::chrono::steady_clock::now() - start;
+
+    // Per position, the signature is an FNV-1a hash of the node counts in order
+    std::uint64_t totalNumNodesSearched = 0;
+    std::uint64_t signature = 0xcbf29ce484222325ULL;
+    out << std::left << std::setw(28) << "Position" << std::setw(12) << "Best move" << std::right << std::setw(14) << "Nodes" << std::setw(12) << "Time (ms)" << std::endl;
+    for (int benchPositionIndex = 0; benchPositionIndex < static_cast<int>(benchPositions.size()); ++benchPositionIndex) {
+        BenchResult const &benchResult = benchResults[benchPositionIndex];
+        out << std::left << std::setw(28) << benchPositions[benchPositionIndex].name << std::setw(12) << benchResult.bestMoveStr << std::right
+            << std::setw(14) << benchResult.numNodesSearched << std::setw(12) << std::chrono::duration_cast<std::chrono::milliseconds>(benchResult.searchTime).count() << std::endl;
+
+        totalNumNodesSearched += benchResult.numNodesSearched;
+        for (int byteIndex = 0; byteIndex < 8; ++byteIndex) {
+            signature = (signature ^ ((benchResult.numNodesSearched >> (byteIndex * 8)) & 0xff)) * 0x100000001b3ULL;
+        }
+    }
+
+    // Totals
+    double totalSeconds = std::chrono::duration<double>(totalTime).count();
+    out << "==========================="
+        << "\nDepth           : " << searchDepth
+        << "\nThreads         : " << numThreads
+        << "\nTotal time (ms) : " << std::chrono::duration_cast<std::chrono::milliseconds>(totalTime).count()
+        << "\nNodes searched  : " << totalNumNodesSearched
+        << "\nNodes/second    : " << static_cast<std::uint64_t>(totalSeconds > 0 ? totalNumNodesSearched / totalSeconds : 0)
+        << "\nSignature       : " << std::hex << std::setw(16) << std::setfill('0') << signature << std::dec << std::setfill(' ') << std::endl;
+}
+
+/*
+ * Search the BenchPosition argument for the Team to move, without randomizing equally ranked moves
+ */
+BenchWrapper::BenchResult BenchWrapper::searchBenchPosition(BenchPosition const &benchPosition) const {
+    std::unique_ptr<ChessBoard> chessBoard = benchPosition.chessBoard->clone();
+    LevelFiveComputer levelFiveComputer(chessBoard->getTeamToMove(), searchDepth, false);
+
+    BenchResult benchResult;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::unique_ptr<BoardMove> bestMove = levelFiveComputer.generateMove(chessBoard);
+    benchResult.searchTime = std::chrono::steady_clock::now() - start;
+    benchResult.numNodesSearched = levelFiveComputer.getNumNodesSearched();
+    benchResult.bestMoveStr = MoveCodeUtilities::toString(MoveCodeUtilities::encode(*bestMove, *chessBoard), *chessBoard);
+    return benchResult;
+}
+
+/*
+ * Static
+ *
+ * Returns the positions searched by the bench
+ * Covers the standard setup, Advanced Pieces, larger ChessBoards and Pieces moving east / west, each from the setup and a few moves in
+ */
+std::vector<BenchWrapper::BenchPosition> BenchWrapper::createBenchPositions() {
+    std::vector<BenchPosition> benchPositions;
+    auto addBenchPositions = [&benchPositions](std::string const &name, std::unique_ptr<ChessBoard> chessBoard) {
+        std::unique_ptr<ChessBoard> middlegameChessBoard = createMiddlegameChessBoard(chessBoard);
+        benchPositions.emplace_back(name, std::move(chessBoard));
+        benchPositions.emplace_back(name + "-middlegame", std::move(middlegameChessBoard));
+    };
+    auto createStandardChessBoard = [](int numRowsOnBoard, int numColsOnBoard, PieceLevel pieceLevel) {
+        std::unique_ptr<ChessBoard> chessBoard = ChessBoardFactory::createChessBoard(numRowsOnBoard, numColsOnBoard);
+        ChessBoardUtilities::applyStandardSetup(chessBoard, pieceLevel);
+        return chessBoard;
+    };
+
+    addBenchPositions("standard", createStandardChessBoard(8, 8, PieceLevel::BASIC));
+    addBenchPositions("advanced", createStandardChessBoard(8, 8, PieceLevel::ADVANCED));
+    addBenchPositions("large", createStandardChessBoard(12, 12, PieceLevel::BASIC));
+    addBenchPositions("large-advanced", createStandardChessBoard(10, 14, PieceLevel::ADVANCED));
+    addBenchPositions("sideways", createSidewaysChessBoard());
+    return benchPositions;
+}
+
+/*
+ * Static
+ *
+ * Returns an 8x8 ChessBoard with the standard setup turned on its side, Team one facing east and Team two facing west
+ */
+std::unique_ptr<ChessBoard> BenchWrapper::createSidewaysChessBoard() {
+    static std::vector<PieceType> const backrowSetupOrder = {
+        PieceType::ROOK,
+        PieceType::KNIGHT,
+        PieceType::BISHOP,
+        PieceType::QUEEN,
+        PieceType::KING,
+        PieceType::BISHOP,
+        PieceType::KNIGHT,
+        PieceType::ROOK
+    };
+
+    std::unique_ptr<ChessBoard> chessBoard = ChessBoardFactory::createChessBoard(8, 8);
+    Team teamOne = chessBoard->getTeamOne();
+    Team teamTwo = chessBoard->getTeamTwo();
+    for (int backrowIndex = 0; backrowIndex < static_cast<int>(backrowSetupOrder.size()); ++backrowIndex) {
+        PieceType pieceType = backrowSetupOrder[backrowIndex];
+        chessBoard->setPosition(BoardSquare(backrowIndex, 0), PieceData(pieceType, PieceLevel::BASIC, teamOne, PieceDirection::EAST, false));
+        chessBoard->setPosition(BoardSquare(backrowIndex, 1), PieceData(PieceType::PAWN, PieceLevel::BASIC, teamOne, PieceDirection::EAST, false));
+        chessBoard->setPosition(BoardSquare(backrowIndex, 7), PieceData(pieceType, PieceLevel::BASIC, teamTwo, PieceDirection::WEST, false));
+        chessBoard->setPosition(BoardSquare(backrowIndex, 6), PieceData(PieceType::PAWN, PieceLevel::BASIC, teamTwo, PieceDirection::WEST, false));
+    }
+    return chessBoard;
+}
+
+/*
+ * Static
+ *
+ * Returns a copy of the ChessBoard argument after a fixed sequence of legal moves, picked by index from each move list
+ */
+std::unique_ptr<ChessBoard> BenchWrapper::createMiddlegameChessBoard(std::unique_ptr<ChessBoard> const &chessBoard) {
+    std::unique_ptr<ChessBoard> middlegameChessBoard = chessBoard->clonePosition();
+    for (int ply = 0; ply < numMiddlegamePlies; ++ply) {
+        MoveList moves;
+        middlegameChessBoard->generateAllLegalMoves(middlegameChessBoard->getTeamToMove(), moves);
+        if (moves.empty()) {
+            break;
+        }
+        middlegameChessBoard->makeMove(moves[(ply * 7 + 3) % moves.size()]);
+    }
+    return middlegameChessBoard->clonePosition();
+}
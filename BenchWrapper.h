@@ -0,0 +1,78 @@
+// BenchWrapper.h
+
+#ifndef BenchWrapper_h
+#define BenchWrapper_h
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ChessBoard.h"
+#include "Constants.h"
+
+
+/**
+ * Bench Wrapper Class
+ * Entry point to the program for the bench command, which runs the LevelFiveComputer search over a fixed set of positions
+ * - Reports the nodes searched, the time taken and the nodes per second
+ * - The signature is a hash of the node counts of every position, ties are not randomized so it only changes when the search does
+ */
+class BenchWrapper final {
+private:
+
+    /**
+     * BenchPosition Struct
+     * A named position searched by the bench
+     */
+    struct BenchPosition final {
+        std::string name;
+        std::unique_ptr<ChessBoard> chessBoard;
+
+        explicit BenchPosition(std::string name, std::unique_ptr<ChessBoard> chessBoard);
+        BenchPosition(BenchPosition const &other) = delete;
+        BenchPosition(BenchPosition &&other) noexcept = default;
+        BenchPosition& operator=(BenchPosition const &other) = delete;
+        BenchPosition& operator=(BenchPosition &&other) noexcept = default;
+        ~BenchPosition() = default;
+    };
+
+    /**
+     * BenchResult Struct
+     * The outcome of searching a BenchPosition
+     */
+    struct BenchResult final {
+        std::uint64_t numNodesSearched = 0;
+        std::string bestMoveStr;
+        std::chrono::nanoseconds searchTime = std::chrono::nanoseconds::zero();
+    };
+
+    static int const numMiddlegamePlies = 10;
+
+    std::ostream &out;
+    int searchDepth;
+    int numThreads;
+
+    static std::vector<BenchPosition> createBenchPositions();
+    static std::unique_ptr<ChessBoard> createSidewaysChessBoard();
+    static std::unique_ptr<ChessBoard> createMiddlegameChessBoard(std::unique_ptr<ChessBoard> const &chessBoard);
+
+    BenchResult searchBenchPosition(BenchPosition const &benchPosition) const;
+
+public:
+    static int const defaultSearchDepth = 3;
+
+    explicit BenchWrapper(std::ostream &out, int searchDepth = defaultSearchDepth, int numThreads = 1);
+    BenchWrapper(BenchWrapper const &other) = delete;
+    BenchWrapper(BenchWrapper &&other) = delete;
+    BenchWrapper& operator=(BenchWrapper &other) = delete;
+    BenchWrapper& operator=(BenchWrapper &&other) = delete;
+    virtual ~BenchWrapper() = default;
+
+    void runBench();
+};
+
+
+#endif /* BenchWrapper_h */
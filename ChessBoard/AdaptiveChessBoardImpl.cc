@@ -0,0 +1,189 @@
+// AdaptiveChessBoardImpl.cc
+
+#include "AdaptiveChessBoardImpl.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "BoardGeometry.h"
+#include "BoardMove.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ChessBoardImpl.h"
+#include "ClassifiedMove.h"
+#include "Cloneable.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+#include "PieceData.h"
+#include "PieceInfo.h"
+#include "StandardChessBoardImpl.h"
+#include "ZobristKeys.h"
+
+
+#pragma mark - Specific To AdaptiveChessBoardImpl
+
+/*
+ * Basic ctor
+ */
+AdaptiveChessBoardImpl::AdaptiveChessBoardImpl(std::unique_ptr<ChessBoard> standardChessBoard, std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry) :
+    AdaptiveChessBoardImpl(std::move(standardChessBoard), false, std::move(zobristKeys), std::move(boardGeometry)) { }
+
+/*
+ * Basic ctor
+ * Wraps a ChessBoard that is already the fallback if isFallback
+ * The wrapped ChessBoard's LegalMoveCache is disabled, every query is answered from this one
+ */
+AdaptiveChessBoardImpl::AdaptiveChessBoardImpl(std::unique_ptr<ChessBoard> chessBoard, bool isFallback,
+                                               std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry) :
+    Cloneable<ChessBoard, AdaptiveChessBoardImpl>(),
+    chessBoard(std::move(chessBoard)), isFallback(isFallback), zobristKeys(std::move(zobristKeys)), boardGeometry(std::move(boardGeometry)) {
+
+    this->chessBoard->setLegalMoveCacheCapacity(0);
+}
+
+/*
+ * Copy ctor
+ */
+AdaptiveChessBoardImpl::AdaptiveChessBoardImpl(AdaptiveChessBoardImpl const &other) : Cloneable<ChessBoard, AdaptiveChessBoardImpl>(other),
+    chessBoard(other.chessBoard->clone()), isFallback(other.isFallback), zobristKeys(other.zobristKeys), boardGeometry(other.boardGeometry) { }
+
+/*
+ * Move ctor
+ */
+AdaptiveChessBoardImpl::AdaptiveChessBoardImpl(AdaptiveChessBoardImpl &&other) noexcept : Cloneable<ChessBoard, AdaptiveChessBoardImpl>(std::move(other)),
+    chessBoard(std::move(other.chessBoard)), isFallback(other.isFallback), zobristKeys(std::move(other.zobristKeys)), boardGeometry(std::move(other.boardGeometry)) { }
+
+/*
+ * Copy assignment
+ */
+AdaptiveChessBoardImpl& AdaptiveChessBoardImpl::operator=(AdaptiveChessBoardImpl const &other) {
+    if (this != &other) {
+        ChessBoard::operator=(other);
+        chessBoard = other.chessBoard->clone();
+        isFallback = other.isFallback;
+        zobristKeys = other.zobristKeys;
+        boardGeometry = other.boardGeometry;
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+AdaptiveChessBoardImpl& AdaptiveChessBoardImpl::operator=(AdaptiveChessBoardImpl &&other) noexcept {
+    if (this != &other) {
+        ChessBoard::operator=(std::move(other));
+        chessBoard = std::move(other.chessBoard);
+        isFallback = other.isFallback;
+        zobristKeys = std::move(other.zobristKeys);
+        boardGeometry = std::move(other.boardGeometry);
+    }
+    return *this;
+}
+
+/*
+ * Replaces the StandardChessBoardImpl with a ChessBoardImpl holding the same Pieces and team to move
+ * ChessBoardImpl shares the ZobristKeys, so the position hash is unchanged
+ */
+void AdaptiveChessBoardImpl::switchToFallback() {
+    std::unique_ptr<ChessBoard> fallbackChessBoard = std::make_unique<ChessBoardImpl>(chessBoard->getNumRowsOnBoard(), chessBoard->getNumColsOnBoard(), zobristKeys, boardGeometry);
+    fallbackChessBoard->setLegalMoveCacheCapacity(0);
+    for (BoardSquare const &boardSquare : *chessBoard) {
+        std::optional<PieceData> pieceData = chessBoard->getPieceDataAt(boardSquare);
+        if (pieceData.has_value()) {
+            fallbackChessBoard->setPosition(boardSquare, pieceData.value());
+        }
+    }
+    fallbackChessBoard->setTeamToMove(chessBoard->getTeamToMove());
+    chessBoard = std::move(fallbackChessBoard);
+    isFallback = true;
+}
+
+/*
+ * True if the position has been moved to the fallback ChessBoardImpl, false while it is held by the StandardChessBoardImpl
+ */
+bool AdaptiveChessBoardImpl::getIsFallback() const {
+    return isFallback;
+}
+
+
+#pragma mark - ChessBoard Interface Implementation
+
+/*
+ * Set the Piece at the BoardSquare argument location based on the PieceData argument
+ * Switches to the fallback ChessBoardImpl first if the StandardChessBoardImpl cannot hold the Piece
+ */
+void AdaptiveChessBoardImpl::setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) {
+    if (!isFallback && !StandardChessBoardImpl::isStandardPiece(pieceData)) {
+        switchToFallback();
+    }
+    chessBoard->setPosition(boardSquare, pieceData);
+}
+
+/*
+ * Copy the position into a new ChessBoard, leaving the move history behind
+ */
+std::unique_ptr<ChessBoard> AdaptiveChessBoardImpl::clonePositionImpl() const {
+    return std::unique_ptr<ChessBoard>(new AdaptiveChessBoardImpl(chessBoard->clonePosition(), isFallback, zobristKeys, boardGeometry));
+}
+
+/* Forwarded to the wrapped ChessBoard */
+std::optional<PieceData> AdaptiveChessBoardImpl::getPieceDataAtImpl(BoardSquare const &boardSquare) const { return chessBoard->getPieceDataAt(boardSquare); }
+std::optional<PieceInfo> AdaptiveChessBoardImpl::getPieceInfoAtImpl(BoardSquare const &boardSquare) const { return chessBoard->getPieceInfoAt(boardSquare); }
+bool AdaptiveChessBoardImpl::isSquareOnBoardImpl(BoardSquare const &boardSquare) const { return chessBoard->isSquareOnBoard(boardSquare); }
+bool AdaptiveChessBoardImpl::isSquareEmptyImpl(BoardSquare const &boardSquare) const { return chessBoard->isSquareEmpty(boardSquare); }
+bool AdaptiveChessBoardImpl::isSquareSameTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const { return chessBoard->isSquareSameTeam(boardSquare, ownTeam); }
+bool AdaptiveChessBoardImpl::isSquareOtherTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const { return chessBoard->isSquareOtherTeam(boardSquare, ownTeam); }
+bool AdaptiveChessBoardImpl::isSquareAttackedImpl(BoardSquare const &boardSquare, Team ownTeam) const { return chessBoard->isSquareAttacked(boardSquare, ownTeam); }
+bool AdaptiveChessBoardImpl::isInCheckImpl(Team team) const { return chessBoard->isInCheck(team); }
+bool AdaptiveChessBoardImpl::isInCheckMateImpl(Team team) const { return chessBoard->isInCheckMate(team); }
+bool AdaptiveChessBoardImpl::isInStaleMateImpl(Team team) const { return chessBoard->isInStaleMate(team); }
+void AdaptiveChessBoardImpl::generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const { chessBoard->generateAllLegalMovesAtSquare(boardSquare, moves); }
+void AdaptiveChessBoardImpl::generateAllLegalMovesImpl(Team team, MoveList &moves) const { chessBoard->generateAllLegalMoves(team, moves); }
+void AdaptiveChessBoardImpl::generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const { chessBoard->generateAllPseudoLegalMoves(team, moves); }
+bool AdaptiveChessBoardImpl::isPseudoLegalMoveLegalImpl(MoveCode moveCode) const { return chessBoard->isPseudoLegalMoveLegal(moveCode); }
+std::vector<std::unique_ptr<BoardMove>> AdaptiveChessBoardImpl::generateCheckApplyingMovesImpl(Team team) const { return chessBoard->generateCheckApplyingMoves(team); }
+std::vector<std::unique_ptr<BoardMove>> AdaptiveChessBoardImpl::generateCapturingMovesImpl(Team team) const { return chessBoard->generateCapturingMoves(team); }
+std::vector<std::unique_ptr<BoardMove>> AdaptiveChessBoardImpl::generateCaptureAvoidingMovesImpl(Team team) const { return chessBoard->generateCaptureAvoidingMoves(team); }
+std::vector<std::unique_ptr<BoardMove>> AdaptiveChessBoardImpl::generateWinningMovesImpl(Team team) const { return chessBoard->generateWinningMoves(team); }
+std::vector<ClassifiedMove> AdaptiveChessBoardImpl::generateClassifiedMovesImpl(Team team) const { return chessBoard->generateClassifiedMoves(team); }
+void AdaptiveChessBoardImpl::clearPositionImpl(BoardSquare const &boardSquare) { chessBoard->clearPosition(boardSquare); }
+void AdaptiveChessBoardImpl::clearBoardImpl() { chessBoard->clearBoard(); }
+std::optional<std::unique_ptr<BoardMove>> AdaptiveChessBoardImpl::createBoardMoveImpl(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType) const { return chessBoard->createBoardMove(fromSquare, toSquare, promotionPieceType); }
+bool AdaptiveChessBoardImpl::isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove) const { return chessBoard->isMoveLegal(boardMove); }
+void AdaptiveChessBoardImpl::makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) { chessBoard->makeMove(boardMove); }
+void AdaptiveChessBoardImpl::makeMoveImpl(MoveCode moveCode) { chessBoard->makeMove(moveCode); }
+bool AdaptiveChessBoardImpl::undoMoveImpl() { return chessBoard->undoMove(); }
+bool AdaptiveChessBoardImpl::redoMoveImpl() { return chessBoard->redoMove(); }
+std::optional<BoardSquare> AdaptiveChessBoardImpl::getEnPassantSquareImpl() const { return chessBoard->getEnPassantSquare(); }
+int AdaptiveChessBoardImpl::getHalfmoveClockImpl() const { return chessBoard->getHalfmoveClock(); }
+std::vector<BoardSquare> const& AdaptiveChessBoardImpl::getPieceSquaresImpl(Team team) const { return chessBoard->getPieceSquares(team); }
+std::vector<BoardSquare> const& AdaptiveChessBoardImpl::getKingSquaresImpl(Team team) const { return chessBoard->getKingSquares(team); }
+std::uint64_t AdaptiveChessBoardImpl::getPositionHashImpl() const { return chessBoard->getPositionHash(); }
+BoardGeometry const& AdaptiveChessBoardImpl::getBoardGeometryImpl() const { return chessBoard->getBoardGeometry(); }
+Team AdaptiveChessBoardImpl::getTeamToMoveImpl() const { return chessBoard->getTeamToMove(); }
+void AdaptiveChessBoardImpl::setTeamToMoveImpl(Team team) { chessBoard->setTeamToMove(team); }
+Team AdaptiveChessBoardImpl::getTeamOneImpl() const { return chessBoard->getTeamOne(); }
+Team AdaptiveChessBoardImpl::getTeamTwoImpl() const { return chessBoard->getTeamTwo(); }
+int AdaptiveChessBoardImpl::getNumRowsOnBoardImpl() const { return chessBoard->getNumRowsOnBoard(); }
+int AdaptiveChessBoardImpl::getNumColsOnBoardImpl() const { return chessBoard->getNumColsOnBoard(); }
+
+/* BoardSquareIterator */
+ChessBoard::BoardSquareIterator AdaptiveChessBoardImpl::beginImpl() { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator AdaptiveChessBoardImpl::beginImpl() const { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator AdaptiveChessBoardImpl::cbeginImpl() const { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator AdaptiveChessBoardImpl::endImpl() { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator AdaptiveChessBoardImpl::endImpl() const { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator AdaptiveChessBoardImpl::cendImpl() const { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+
+/* ReverseBoardSquareIterator */
+ChessBoard::ReverseBoardSquareIterator AdaptiveChessBoardImpl::rbeginImpl() { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator AdaptiveChessBoardImpl::rbeginImpl() const { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator AdaptiveChessBoardImpl::crbeginImpl() const { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator AdaptiveChessBoardImpl::rendImpl() { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator AdaptiveChessBoardImpl::rendImpl() const { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator AdaptiveChessBoardImpl::crendImpl() const { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
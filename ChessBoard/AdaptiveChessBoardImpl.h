@@ -0,0 +1,126 @@
+// AdaptiveChessBoardImpl.h
+
+#ifndef AdaptiveChessBoardImpl_h
+#define AdaptiveChessBoardImpl_h
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "BoardGeometry.h"
+#include "BoardMove.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ClassifiedMove.h"
+#include "Cloneable.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+#include "PieceData.h"
+#include "PieceInfo.h"
+#include "ZobristKeys.h"
+
+
+/**
+ * AdaptiveChessBoardImpl ChessBoard Class
+ * An 8x8 ChessBoard that forwards every call to a StandardChessBoardImpl for as long as it only holds standard Pieces
+ * - The first time a Piece a StandardChessBoardImpl cannot hold is placed, the position is copied into a ChessBoardImpl that is used from then on
+ * - Pieces are placed while setting up a game, before any move is made, so the move history is not carried over
+ */
+class AdaptiveChessBoardImpl final : public Cloneable<ChessBoard, AdaptiveChessBoardImpl> {
+
+private:
+    std::unique_ptr<ChessBoard> chessBoard;                 // StandardChessBoardImpl until isFallback, ChessBoardImpl after
+    bool isFallback;
+
+    std::shared_ptr<ZobristKeys const> zobristKeys;         // Used to create the fallback ChessBoardImpl
+    std::shared_ptr<BoardGeometry const> boardGeometry;
+
+
+    /* Specific To AdaptiveChessBoardImpl */
+    explicit AdaptiveChessBoardImpl(std::unique_ptr<ChessBoard> chessBoard, bool isFallback,
+                                    std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry);
+
+    void switchToFallback();
+
+
+    /* ChessBoard Interface Implementation */
+    std::optional<PieceData> getPieceDataAtImpl(BoardSquare const &boardSquare) const override;
+    std::optional<PieceInfo> getPieceInfoAtImpl(BoardSquare const &boardSquare) const override;
+
+    bool isSquareOnBoardImpl(BoardSquare const &boardSquare) const override;
+    bool isSquareEmptyImpl(BoardSquare const &boardSquare) const override;
+    bool isSquareSameTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const override;
+    bool isSquareOtherTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const override;
+    bool isSquareAttackedImpl(BoardSquare const &boardSquare, Team ownTeam) const override;
+
+    bool isInCheckImpl(Team team) const override;
+    bool isInCheckMateImpl(Team team) const override;
+    bool isInStaleMateImpl(Team team) const override;
+
+    void generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const override;
+    void generateAllLegalMovesImpl(Team team, MoveList &moves) const override;
+    void generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const override;
+    bool isPseudoLegalMoveLegalImpl(MoveCode moveCode) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateCheckApplyingMovesImpl(Team team) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateCapturingMovesImpl(Team team) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateCaptureAvoidingMovesImpl(Team team) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateWinningMovesImpl(Team team) const override;
+    std::vector<ClassifiedMove> generateClassifiedMovesImpl(Team team) const override;
+
+    void setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) override;
+    void clearPositionImpl(BoardSquare const &boardSquare) override;
+    void clearBoardImpl() override;
+
+    std::optional<std::unique_ptr<BoardMove>> createBoardMoveImpl(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType = std::nullopt) const override;
+    bool isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove) const override;
+    void makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) override;
+    void makeMoveImpl(MoveCode moveCode) override;
+    bool undoMoveImpl() override;                               // True if move is available to be undone (only performs undo if move available to be undone)
+    bool redoMoveImpl() override;                               // True if move is available to be redone (only performs redo if move available to be redone)
+
+    std::unique_ptr<ChessBoard> clonePositionImpl() const override;
+    std::optional<BoardSquare> getEnPassantSquareImpl() const override;
+    int getHalfmoveClockImpl() const override;
+    std::vector<BoardSquare> const& getPieceSquaresImpl(Team team) const override;
+    std::vector<BoardSquare> const& getKingSquaresImpl(Team team) const override;
+    std::uint64_t getPositionHashImpl() const override;
+    BoardGeometry const& getBoardGeometryImpl() const override;
+
+    Team getTeamToMoveImpl() const override;
+    void setTeamToMoveImpl(Team team) override;
+
+    Team getTeamOneImpl() const override;
+    Team getTeamTwoImpl() const override;
+
+    int getNumRowsOnBoardImpl() const override;
+    int getNumColsOnBoardImpl() const override;
+
+    BoardSquareIterator beginImpl() override;
+    BoardSquareIterator beginImpl() const override;
+    BoardSquareIterator cbeginImpl() const override;
+    BoardSquareIterator endImpl() override;
+    BoardSquareIterator endImpl() const override;
+    BoardSquareIterator cendImpl() const override;
+
+    ReverseBoardSquareIterator rbeginImpl() override;
+    ReverseBoardSquareIterator rbeginImpl() const override;
+    ReverseBoardSquareIterator crbeginImpl() const override;
+    ReverseBoardSquareIterator rendImpl() override;
+    ReverseBoardSquareIterator rendImpl() const override;
+    ReverseBoardSquareIterator crendImpl() const override;
+
+public:
+    explicit AdaptiveChessBoardImpl(std::unique_ptr<ChessBoard> standardChessBoard, std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry);
+    AdaptiveChessBoardImpl(AdaptiveChessBoardImpl const &other);
+    AdaptiveChessBoardImpl(AdaptiveChessBoardImpl &&other) noexcept;
+    AdaptiveChessBoardImpl& operator=(AdaptiveChessBoardImpl const &other);
+    AdaptiveChessBoardImpl& operator=(AdaptiveChessBoardImpl &&other) noexcept;
+    virtual ~AdaptiveChessBoardImpl() = default;
+
+    bool getIsFallback() const;
+};
+
+
+#endif /* AdaptiveChessBoardImpl_h */
@@ -0,0 +1,48 @@
+// Bitboard.cc
+
+#include "Bitboard.h"
+
+#include <array>
+#include <cstdint>
+
+
+/*
+ * Returns the number of squares in the Bitboard
+ */
+int Bitboard::count() const {
+    int numSquares = 0;
+    for (std::uint64_t word : words) {
+        numSquares += __builtin_popcountll(word);
+    }
+    return numSquares;
+}
+
+/*
+ * Returns a copy of the Bitboard with every square index moved up by the numSquares argument, or down if it is negative
+ * Squares moved past either end are dropped, squares moved across the edge of a row are not, callers mask those out beforehand
+ */
+Bitboard Bitboard::shifted(int numSquares) const {
+    Bitboard shiftedBitboard;
+    if (numSquares >= 0) {
+        int wordShift = numSquares >> 6;
+        int bitShift = numSquares & 63;
+        for (int wordIndex = numWords - 1; wordIndex >= wordShift; --wordIndex) {
+            std::uint64_t word = words[wordIndex - wordShift] << bitShift;
+            if (bitShift != 0 && wordIndex - wordShift - 1 >= 0) {
+                word |= words[wordIndex - wordShift - 1] >> (64 - bitShift);
+            }
+            shiftedBitboard.words[wordIndex] = word;
+        }
+    } else {
+        int wordShift = (-numSquares) >> 6;
+        int bitShift = (-numSquares) & 63;
+        for (int wordIndex = 0; wordIndex + wordShift < numWords; ++wordIndex) {
+            std::uint64_t word = words[wordIndex + wordShift] >> bitShift;
+            if (bitShift != 0 && wordIndex + wordShift + 1 < numWords) {
+                word |= words[wordIndex + wordShift + 1] << (64 - bitShift);
+            }
+            shiftedBitboard.words[wordIndex] = word;
+        }
+    }
+    return shiftedBitboard;
+}
@@ -0,0 +1,126 @@
+// Bitboard.h
+
+#ifndef Bitboard_h
+#define Bitboard_h
+
+#include <array>
+#include <cstdint>
+
+
+/**
+ * Bitboard Class
+ * Fixed width set of ChessBoard squares, one bit per square index (row * numColsOnBoard + col)
+ * - Wide enough for the 676 squares of the largest (26x26) ChessBoard, whatever the size of the ChessBoard it describes
+ * - Bits past the last square of the ChessBoard are never set by BitboardGeometry, callers mask with its board mask after shifting
+ */
+class Bitboard final {
+public:
+    static int const numWords = 11;
+    static int const numBits = numWords * 64;
+
+private:
+    std::array<std::uint64_t, numWords> words;
+
+public:
+    Bitboard() : words{} { }
+    Bitboard(Bitboard const &other) = default;
+    Bitboard(Bitboard &&other) noexcept = default;
+    Bitboard& operator=(Bitboard const &other) = default;
+    Bitboard& operator=(Bitboard &&other) noexcept = default;
+    ~Bitboard() = default;
+
+    inline bool test(int squareIndex) const { return (words[squareIndex >> 6] >> (squareIndex & 63)) & 1; }
+    inline void set(int squareIndex) { words[squareIndex >> 6] |= std::uint64_t(1) << (squareIndex & 63); }
+    inline void reset(int squareIndex) { words[squareIndex >> 6] &= ~(std::uint64_t(1) << (squareIndex & 63)); }
+
+    inline bool isEmpty() const {
+        std::uint64_t combinedWords = 0;
+        for (std::uint64_t word : words) {
+            combinedWords |= word;
+        }
+        return combinedWords == 0;
+    }
+
+    inline bool intersects(Bitboard const &other) const {
+        std::uint64_t combinedWords = 0;
+        for (int wordIndex = 0; wordIndex < numWords; ++wordIndex) {
+            combinedWords |= words[wordIndex] & other.words[wordIndex];
+        }
+        return combinedWords != 0;
+    }
+    inline bool intersects(Bitboard const &other, Bitboard const &mask) const {
+        std::uint64_t combinedWords = 0;
+        for (int wordIndex = 0; wordIndex < numWords; ++wordIndex) {
+            combinedWords |= words[wordIndex] & other.words[wordIndex] & mask.words[wordIndex];
+        }
+        return combinedWords != 0;
+    }
+
+    /*
+     * Lowest and highest square indices in the Bitboard, which must not be empty
+     */
+    inline int getLowestSquareIndex() const {
+        int wordIndex = 0;
+        while (words[wordIndex] == 0) {
+            ++wordIndex;
+        }
+        return wordIndex * 64 + __builtin_ctzll(words[wordIndex]);
+    }
+    inline int getHighestSquareIndex() const {
+        int wordIndex = numWords - 1;
+        while (words[wordIndex] == 0) {
+            --wordIndex;
+        }
+        return wordIndex * 64 + 63 - __builtin_clzll(words[wordIndex]);
+    }
+
+    /*
+     * Calls the Function argument with every square index in the Bitboard, lowest first
+     */
+    template <typename Function>
+    inline void forEachSquareIndex(Function &&function) const {
+        for (int wordIndex = 0; wordIndex < numWords; ++wordIndex) {
+            for (std::uint64_t word = words[wordIndex]; word != 0; word &= word - 1) {
+                function(wordIndex * 64 + __builtin_ctzll(word));
+            }
+        }
+    }
+
+    inline Bitboard& operator&=(Bitboard const &other) {
+        for (int wordIndex = 0; wordIndex < numWords; ++wordIndex) {
+            words[wordIndex] &= other.words[wordIndex];
+        }
+        return *this;
+    }
+    inline Bitboard& operator|=(Bitboard const &other) {
+        for (int wordIndex = 0; wordIndex < numWords; ++wordIndex) {
+            words[wordIndex] |= other.words[wordIndex];
+        }
+        return *this;
+    }
+    inline Bitboard& operator^=(Bitboard const &other) {
+        for (int wordIndex = 0; wordIndex < numWords; ++wordIndex) {
+            words[wordIndex] ^= other.words[wordIndex];
+        }
+        return *this;
+    }
+    inline Bitboard& andNot(Bitboard const &other) {
+        for (int wordIndex = 0; wordIndex < numWords; ++wordIndex) {
+            words[wordIndex] &= ~other.words[wordIndex];
+        }
+        return *this;
+    }
+
+    inline friend Bitboard operator&(Bitboard lhs, Bitboard const &rhs) { return lhs &= rhs; }
+    inline friend Bitboard operator|(Bitboard lhs, Bitboard const &rhs) { return lhs |= rhs; }
+    inline friend Bitboard operator^(Bitboard lhs, Bitboard const &rhs) { return lhs ^= rhs; }
+
+    inline bool operator==(Bitboard const &other) const { return words == other.words; }
+    inline bool operator!=(Bitboard const &other) const { return words != other.words; }
+
+    int count() const;
+    Bitboard shifted(int numSquares) const;
+};
+
+
+#endif /* Bitboard_h */
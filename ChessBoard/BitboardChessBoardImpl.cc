@@ -0,0 +1,1113 @@
+// BitboardChessBoardImpl.cc
+
+#include "BitboardChessBoardImpl.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Bitboard.h"
+#include "BitboardGeometry.h"
+#include "BoardGeometry.h"
+#include "BoardMove.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ClassifiedMove.h"
+#include "Cloneable.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveDirection.h"
+#include "MoveList.h"
+#include "MovePicker.h"
+#include "Piece.h"
+#include "PieceCode.h"
+#include "PieceData.h"
+#include "PieceFactory.h"
+#include "PieceInfo.h"
+#include "PositionState.h"
+#include "ZobristKeys.h"
+
+
+/*
+ * Static
+ *
+ * The PieceTypes a Pawn can promote to, in the order Pawn generates them
+ */
+std::array<PieceType, 4> const BitboardChessBoardImpl::promotionPieceTypes = { PieceType::QUEEN, PieceType::ROOK, PieceType::KNIGHT, PieceType::BISHOP };
+
+
+#pragma mark - ScopedBoardMove
+
+/*
+ * Basic ctor
+ * Predicates using the guard are logically const, the BitboardChessBoardImpl is restored before the guard is destroyed
+ */
+BitboardChessBoardImpl::ScopedBoardMove::ScopedBoardMove(BitboardChessBoardImpl const &chessBoard, MoveCode moveCode) :
+    chessBoard(const_cast<BitboardChessBoardImpl&>(chessBoard)), undoRecord(this->chessBoard.applyMove(moveCode)) { }
+
+/*
+ * Dtor
+ */
+BitboardChessBoardImpl::ScopedBoardMove::~ScopedBoardMove() {
+    chessBoard.revertMove(undoRecord);
+}
+
+
+#pragma mark - Specific To BitboardChessBoardImpl
+
+/*
+ * Basic ctor
+ */
+BitboardChessBoardImpl::BitboardChessBoardImpl(int numRows, int numCols, std::shared_ptr<ZobristKeys const> zobristKeys,
+                                               std::shared_ptr<BoardGeometry const> boardGeometry, std::shared_ptr<BitboardGeometry const> bitboardGeometry) :
+    Cloneable<ChessBoard, BitboardChessBoardImpl>(),
+    numRowsOnBoard(numRows), numColsOnBoard(numCols), squares(numRows * numCols, EMPTY_PIECE_CODE), positionState(std::nullopt, teamOne, 0),
+    zobristKeys(std::move(zobristKeys)), boardGeometry(std::move(boardGeometry)), bitboardGeometry(std::move(bitboardGeometry)), positionHash(0) { }
+
+/*
+ * Copy ctor
+ */
+BitboardChessBoardImpl::BitboardChessBoardImpl(BitboardChessBoardImpl const &other) :
+    BitboardChessBoardImpl(other, true) { }
+
+/*
+ * Copy ctor
+ * Copies the move history only if shouldCopyMoveHistory, otherwise the copy starts with nothing to undo or redo
+ */
+BitboardChessBoardImpl::BitboardChessBoardImpl(BitboardChessBoardImpl const &other, bool shouldCopyMoveHistory) : Cloneable<ChessBoard, BitboardChessBoardImpl>(other),
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard), squares(other.squares),
+    teamOccupancy(other.teamOccupancy), pieceTypeOccupancy(other.pieceTypeOccupancy), pieceDirectionOccupancy(other.pieceDirectionOccupancy),
+    advancedOccupancy(other.advancedOccupancy), unmovedOccupancy(other.unmovedOccupancy), positionState(other.positionState),
+    zobristKeys(other.zobristKeys), boardGeometry(other.boardGeometry), bitboardGeometry(other.bitboardGeometry), positionHash(other.positionHash) {
+
+    if (shouldCopyMoveHistory) {
+        undoRecords = other.undoRecords;
+        redoMoveCodes = other.redoMoveCodes;
+    }
+}
+
+/*
+ * Move ctor
+ */
+BitboardChessBoardImpl::BitboardChessBoardImpl(BitboardChessBoardImpl &&other) noexcept : Cloneable<ChessBoard, BitboardChessBoardImpl>(std::move(other)),
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard), squares(std::move(other.squares)),
+    teamOccupancy(other.teamOccupancy), pieceTypeOccupancy(other.pieceTypeOccupancy), pieceDirectionOccupancy(other.pieceDirectionOccupancy),
+    advancedOccupancy(other.advancedOccupancy), unmovedOccupancy(other.unmovedOccupancy), positionState(std::move(other.positionState)),
+    undoRecords(std::move(other.undoRecords)), redoMoveCodes(std::move(other.redoMoveCodes)),
+    zobristKeys(std::move(other.zobristKeys)), boardGeometry(std::move(other.boardGeometry)), bitboardGeometry(std::move(other.bitboardGeometry)), positionHash(other.positionHash) { }
+
+/*
+ * Copy assignment
+ */
+BitboardChessBoardImpl& BitboardChessBoardImpl::operator=(BitboardChessBoardImpl const &other) {
+    if (this != &other) {
+        ChessBoard::operator=(other);
+
+        // Copy squares
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        squares = other.squares;
+        teamOccupancy = other.teamOccupancy;
+        pieceTypeOccupancy = other.pieceTypeOccupancy;
+        pieceDirectionOccupancy = other.pieceDirectionOccupancy;
+        advancedOccupancy = other.advancedOccupancy;
+        unmovedOccupancy = other.unmovedOccupancy;
+        positionState = other.positionState;
+
+        // Copy move history
+        undoRecords = other.undoRecords;
+        redoMoveCodes = other.redoMoveCodes;
+
+        zobristKeys = other.zobristKeys;
+        boardGeometry = other.boardGeometry;
+        bitboardGeometry = other.bitboardGeometry;
+        positionHash = other.positionHash;
+        arePieceSquaresValid = { false, false };
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+BitboardChessBoardImpl& BitboardChessBoardImpl::operator=(BitboardChessBoardImpl &&other) noexcept {
+    if (this != &other) {
+        ChessBoard::operator=(std::move(other));
+
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        squares = std::move(other.squares);
+        teamOccupancy = other.teamOccupancy;
+        pieceTypeOccupancy = other.pieceTypeOccupancy;
+        pieceDirectionOccupancy = other.pieceDirectionOccupancy;
+        advancedOccupancy = other.advancedOccupancy;
+        unmovedOccupancy = other.unmovedOccupancy;
+        positionState = std::move(other.positionState);
+        undoRecords = std::move(other.undoRecords);
+        redoMoveCodes = std::move(other.redoMoveCodes);
+        zobristKeys = std::move(other.zobristKeys);
+        boardGeometry = std::move(other.boardGeometry);
+        bitboardGeometry = std::move(other.bitboardGeometry);
+        positionHash = other.positionHash;
+        arePieceSquaresValid = { false, false };
+    }
+    return *this;
+}
+
+/*
+ * Returns the square index of the BoardSquare argument, which must be on the ChessBoard
+ */
+int BitboardChessBoardImpl::getSquareIndex(BoardSquare const &boardSquare) const {
+    return boardSquare.boardRow * numColsOnBoard + boardSquare.boardCol;
+}
+
+/*
+ * Returns the BoardSquare at the square index argument
+ */
+BoardSquare BitboardChessBoardImpl::getBoardSquare(int squareIndex) const {
+    return BoardSquare(squareIndex / numColsOnBoard, squareIndex % numColsOnBoard);
+}
+
+/*
+ * Returns the PieceCode at the BoardSquare argument
+ * - OFF_BOARD_PIECE_CODE if BoardSquare argument is not on the ChessBoard
+ */
+PieceCode BitboardChessBoardImpl::getPieceCodeAt(BoardSquare const &boardSquare) const {
+    return isSquareOnBoard(boardSquare)
+        ? squares[getSquareIndex(boardSquare)]
+        : OFF_BOARD_PIECE_CODE;
+}
+
+/*
+ * Returns the index of the Team argument into the per Team Bitboards
+ */
+int BitboardChessBoardImpl::getTeamIndex(Team team) const {
+    return team == teamOne
+        ? 0
+        : 1;
+}
+
+/*
+ * Returns team opposite to team argument
+ */
+Team BitboardChessBoardImpl::getOtherTeam(Team team) const {
+    return team == teamOne
+        ? teamTwo
+        : teamOne;
+}
+
+/*
+ * Returns the squares occupied by a Piece of either Team
+ */
+Bitboard BitboardChessBoardImpl::getOccupancy() const {
+    return teamOccupancy[0] | teamOccupancy[1];
+}
+
+/*
+ * Write the PieceCode argument to the square at the square index argument, keeping the Bitboards and position hash in sync
+ */
+void BitboardChessBoardImpl::setPieceCodeAt(int squareIndex, PieceCode newPieceCode) {
+    PieceCode &pieceCode = squares[squareIndex];
+    int boardRow = squareIndex / numColsOnBoard;
+    int boardCol = squareIndex % numColsOnBoard;
+    positionHash ^= zobristKeys->getPieceKey(boardRow, boardCol, pieceCode) ^ zobristKeys->getPieceKey(boardRow, boardCol, newPieceCode);
+
+    if (PieceCodeUtilities::isPiece(pieceCode)) {
+        teamOccupancy[getTeamIndex(PieceCodeUtilities::getTeam(pieceCode))].reset(squareIndex);
+        pieceTypeOccupancy[static_cast<int>(PieceCodeUtilities::getPieceType(pieceCode))].reset(squareIndex);
+        pieceDirectionOccupancy[static_cast<int>(PieceCodeUtilities::getPieceDirection(pieceCode))].reset(squareIndex);
+        advancedOccupancy.reset(squareIndex);
+        unmovedOccupancy.reset(squareIndex);
+    }
+    if (PieceCodeUtilities::isPiece(newPieceCode)) {
+        teamOccupancy[getTeamIndex(PieceCodeUtilities::getTeam(newPieceCode))].set(squareIndex);
+        pieceTypeOccupancy[static_cast<int>(PieceCodeUtilities::getPieceType(newPieceCode))].set(squareIndex);
+        pieceDirectionOccupancy[static_cast<int>(PieceCodeUtilities::getPieceDirection(newPieceCode))].set(squareIndex);
+        if (PieceCodeUtilities::getPieceLevel(newPieceCode) == PieceLevel::ADVANCED) {
+            advancedOccupancy.set(squareIndex);
+        }
+        if (!PieceCodeUtilities::getHasMoved(newPieceCode)) {
+            unmovedOccupancy.set(squareIndex);
+        }
+    }
+    pieceCode = newPieceCode;
+    arePieceSquaresValid = { false, false };
+}
+
+/*
+ * Set the square of the Piece that can currently be captured en passant, keeping the position hash in sync
+ */
+void BitboardChessBoardImpl::setEnPassantSquare(std::optional<BoardSquare> const &newEnPassantSquare) {
+    std::optional<BoardSquare> &enPassantSquare = positionState.enPassantSquare;
+    if (enPassantSquare.has_value()) {
+        positionHash ^= zobristKeys->getEnPassantKey(enPassantSquare.value().boardRow, enPassantSquare.value().boardCol);
+    }
+    if (newEnPassantSquare.has_value()) {
+        positionHash ^= zobristKeys->getEnPassantKey(newEnPassantSquare.value().boardRow, newEnPassantSquare.value().boardCol);
+    }
+    enPassantSquare = newEnPassantSquare;
+}
+
+/*
+ * Apply the move represented by the MoveCode argument by writing its squares directly, and advance the PositionState past it
+ * Returns the UndoRecord that reverts it, without touching the undo and redo stacks
+ */
+BitboardChessBoardImpl::UndoRecord BitboardChessBoardImpl::applyMove(MoveCode moveCode) {
+    int fromSquareIndex = MoveCodeUtilities::getFromSquareIndex(moveCode);
+    int toSquareIndex = MoveCodeUtilities::getToSquareIndex(moveCode);
+    int captureSquareIndex = getSquareIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard));
+    std::optional<BoardSquare> const &enPassantSquare = positionState.enPassantSquare;
+
+    UndoRecord undoRecord = {
+        moveCode, squares[fromSquareIndex], squares[captureSquareIndex], squares[toSquareIndex], EMPTY_PIECE_CODE,
+        enPassantSquare.has_value() ? getSquareIndex(enPassantSquare.value()) : -1, positionState.teamToMove, positionState.halfmoveClock, positionHash
+    };
+
+    // Move the Piece, promoting it if needed
+    PieceCode movedPieceCode = PieceCodeUtilities::withHasMoved(undoRecord.movedPieceCode, true);
+    if (MoveCodeUtilities::isPromotion(moveCode)) {
+        movedPieceCode = PieceCodeUtilities::withPieceType(movedPieceCode, MoveCodeUtilities::getPromotionPieceType(moveCode).value());
+    }
+    setPieceCodeAt(captureSquareIndex, EMPTY_PIECE_CODE);
+    setPieceCodeAt(toSquareIndex, movedPieceCode);
+    setPieceCodeAt(fromSquareIndex, EMPTY_PIECE_CODE);
+
+    // Move the Rook of a castle
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        int rookFromSquareIndex = getSquareIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard));
+        int rookToSquareIndex = getSquareIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard));
+        undoRecord.castledRookPieceCode = squares[rookFromSquareIndex];
+        setPieceCodeAt(rookToSquareIndex, PieceCodeUtilities::withHasMoved(undoRecord.castledRookPieceCode, true));
+        setPieceCodeAt(rookFromSquareIndex, EMPTY_PIECE_CODE);
+    }
+
+    // Advance the PositionState
+    bool doesResetHalfmoveClock =
+        PieceCodeUtilities::getPieceType(undoRecord.movedPieceCode) == PieceType::PAWN ||
+        PieceCodeUtilities::isPiece(undoRecord.capturedPieceCode);
+    setEnPassantSquare(MoveCodeUtilities::getDoesEnableEnpassant(moveCode) ? std::make_optional<BoardSquare>(getBoardSquare(toSquareIndex)) : std::nullopt);
+    setTeamToMove(getOtherTeam(PieceCodeUtilities::getTeam(undoRecord.movedPieceCode)));
+    positionState.halfmoveClock = doesResetHalfmoveClock ? 0 : positionState.halfmoveClock + 1;
+    return undoRecord;
+}
+
+/*
+ * Revert the move recorded by the UndoRecord argument, which must be the last move applied
+ * The prior PositionState and position hash are written back directly
+ */
+void BitboardChessBoardImpl::revertMove(UndoRecord const &undoRecord) {
+    MoveCode moveCode = undoRecord.moveCode;
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        setPieceCodeAt(getSquareIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard)), EMPTY_PIECE_CODE);
+        setPieceCodeAt(getSquareIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard)), undoRecord.castledRookPieceCode);
+    }
+    setPieceCodeAt(MoveCodeUtilities::getToSquareIndex(moveCode), undoRecord.replacedPieceCode);
+    setPieceCodeAt(getSquareIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard)), undoRecord.capturedPieceCode);
+    setPieceCodeAt(MoveCodeUtilities::getFromSquareIndex(moveCode), undoRecord.movedPieceCode);
+
+    positionState.enPassantSquare = undoRecord.enPassantSquareIndex >= 0
+        ? std::make_optional<BoardSquare>(getBoardSquare(undoRecord.enPassantSquareIndex))
+        : std::nullopt;
+    positionState.teamToMove = undoRecord.teamToMove;
+    positionState.halfmoveClock = undoRecord.halfmoveClock;
+    positionHash = undoRecord.positionHash;
+}
+
+/*
+ * Clears the recorded redo moves
+ */
+void BitboardChessBoardImpl::clearRedoMoves() {
+    redoMoveCodes.clear();
+}
+
+/*
+ * True if a Pawn of the PieceDirection argument promotes on reaching the square index argument, false otherwise
+ */
+bool BitboardChessBoardImpl::isPromotionSquare(int squareIndex, PieceDirection pieceDirection) const {
+    switch (pieceDirection) {
+        case PieceDirection::NORTH: return squareIndex < numColsOnBoard;
+        case PieceDirection::SOUTH: return squareIndex >= (numRowsOnBoard - 1) * numColsOnBoard;
+        case PieceDirection::EAST: return squareIndex % numColsOnBoard == numColsOnBoard - 1;
+        case PieceDirection::WEST: return squareIndex % numColsOnBoard == 0;
+        default:
+            assert(false);
+            return false;
+    }
+}
+
+/*
+ * Appends a standard move from the square index argument to every square of the targets argument to the MoveList argument
+ */
+void BitboardChessBoardImpl::addTargetMoves(int fromSquareIndex, Bitboard const &targets, Bitboard const &otherTeamOccupancy, MoveList &moves) const {
+    targets.forEachSquareIndex([&](int toSquareIndex) {
+        moves.push_back(MoveCodeUtilities::createMoveCode(fromSquareIndex, toSquareIndex, MoveKind::STANDARD, false, std::nullopt, otherTeamOccupancy.test(toSquareIndex)));
+    });
+}
+
+/*
+ * Appends the Pawn move represented by the arguments to the MoveList argument, or a variant per promotion PieceType if it reaches its last row or col
+ */
+void BitboardChessBoardImpl::addPawnMoves(int fromSquareIndex, int toSquareIndex, PieceDirection pieceDirection, MoveKind moveKind, bool doesEnableEnpassant, bool isCapture, MoveList &moves) const {
+    if (isPromotionSquare(toSquareIndex, pieceDirection)) {
+        for (PieceType promotionPieceType : promotionPieceTypes) {
+            moves.push_back(MoveCodeUtilities::createMoveCode(fromSquareIndex, toSquareIndex, moveKind, doesEnableEnpassant, promotionPieceType, isCapture));
+        }
+    } else {
+        moves.push_back(MoveCodeUtilities::createMoveCode(fromSquareIndex, toSquareIndex, moveKind, doesEnableEnpassant, std::nullopt, isCapture));
+    }
+}
+
+/*
+ * Appends the pushes and captures of every Pawn of the Team and PieceDirection arguments to the MoveList argument
+ * Each kind of move is found for all of the Pawns at once by shifting their squares, the from square is recovered from the shift
+ */
+void BitboardChessBoardImpl::generatePawnMoves(Team team, PieceDirection pieceDirection, MoveList &moves) const {
+    Bitboard pawns = teamOccupancy[getTeamIndex(team)] & pieceTypeOccupancy[static_cast<int>(PieceType::PAWN)] & pieceDirectionOccupancy[static_cast<int>(pieceDirection)];
+    if (pawns.isEmpty()) {
+        return;
+    }
+
+    MoveDirection pushDirection(0, 0);
+    std::array<MoveDirection, 2> captureDirections = { MoveDirection(0, 0), MoveDirection(0, 0) };
+    switch (pieceDirection) {
+        case PieceDirection::NORTH:
+            pushDirection = MoveDirection(-1, 0);
+            captureDirections = { MoveDirection(-1, -1), MoveDirection(-1, 1) };
+            break;
+        case PieceDirection::SOUTH:
+            pushDirection = MoveDirection(1, 0);
+            captureDirections = { MoveDirection(1, -1), MoveDirection(1, 1) };
+            break;
+        case PieceDirection::EAST:
+            pushDirection = MoveDirection(0, 1);
+            captureDirections = { MoveDirection(-1, 1), MoveDirection(1, 1) };
+            break;
+        case PieceDirection::WEST:
+            pushDirection = MoveDirection(0, -1);
+            captureDirections = { MoveDirection(-1, -1), MoveDirection(1, -1) };
+            break;
+        default:
+            assert(false);
+    }
+
+    BitboardGeometry const &geometry = *bitboardGeometry;
+    Bitboard const &otherTeamOccupancy = teamOccupancy[getTeamIndex(getOtherTeam(team))];
+    Bitboard emptySquares = geometry.getBoardMask();
+    emptySquares.andNot(getOccupancy());
+    int pushOffset = pushDirection.rowDirection * numColsOnBoard + pushDirection.colDirection;
+
+    // Single, double (unmoved) and triple (unmoved AdvancedPawn) pushes, each step onto an empty square
+    Bitboard singlePushes = geometry.shiftSquares(pawns, pushDirection.rowDirection, pushDirection.colDirection) &= emptySquares;
+    singlePushes.forEachSquareIndex([&](int toSquareIndex) {
+        addPawnMoves(toSquareIndex - pushOffset, toSquareIndex, pieceDirection, MoveKind::STANDARD, false, false, moves);
+    });
+
+    Bitboard unmovedPawns = pawns & unmovedOccupancy;
+    if (!unmovedPawns.isEmpty()) {
+        Bitboard doublePushes = geometry.shiftSquares(unmovedPawns, pushDirection.rowDirection, pushDirection.colDirection) &= emptySquares;
+        doublePushes = geometry.shiftSquares(doublePushes, pushDirection.rowDirection, pushDirection.colDirection) &= emptySquares;
+        doublePushes.forEachSquareIndex([&](int toSquareIndex) {
+            addPawnMoves(toSquareIndex - 2 * pushOffset, toSquareIndex, pieceDirection, MoveKind::STANDARD, true, false, moves);
+        });
+
+        Bitboard triplePushes = unmovedPawns & advancedOccupancy;
+        if (!triplePushes.isEmpty()) {
+            for (int numSteps = 0; numSteps < 3; ++numSteps) {
+                triplePushes = geometry.shiftSquares(triplePushes, pushDirection.rowDirection, pushDirection.colDirection) &= emptySquares;
+            }
+            triplePushes.forEachSquareIndex([&](int toSquareIndex) {
+                addPawnMoves(toSquareIndex - 3 * pushOffset, toSquareIndex, pieceDirection, MoveKind::STANDARD, true, false, moves);
+            });
+        }
+    }
+
+    // Captures onto an occupied square of the other Team
+    for (MoveDirection const &captureDirection : captureDirections) {
+        int captureOffset = captureDirection.rowDirection * numColsOnBoard + captureDirection.colDirection;
+        Bitboard captures = geometry.shiftSquares(pawns, captureDirection.rowDirection, captureDirection.colDirection) &= otherTeamOccupancy;
+        captures.forEachSquareIndex([&](int toSquareIndex) {
+            addPawnMoves(toSquareIndex - captureOffset, toSquareIndex, pieceDirection, MoveKind::STANDARD, false, true, moves);
+        });
+    }
+}
+
+/*
+ * Appends the en passant captures of the Team argument to the MoveList argument, following the rules of Pawn
+ * - NORTH and SOUTH Pawns beside the en passant square in its row capture it, moving forward into its col
+ * - EAST and WEST Pawns beside the en passant square in its col capture it, moving forward into its row
+ */
+void BitboardChessBoardImpl::generateEnPassantMoves(Team team, MoveList &moves) const {
+    if (!positionState.enPassantSquare.has_value() || !isSquareOtherTeam(positionState.enPassantSquare.value(), team)) {
+        return;
+    }
+
+    BoardSquare const &enPassantSquare = positionState.enPassantSquare.value();
+    std::array<BoardSquare, 4> const fromSquares = {
+        BoardSquare(enPassantSquare.boardRow, enPassantSquare.boardCol - 1),
+        BoardSquare(enPassantSquare.boardRow, enPassantSquare.boardCol + 1),
+        BoardSquare(enPassantSquare.boardRow - 1, enPassantSquare.boardCol),
+        BoardSquare(enPassantSquare.boardRow + 1, enPassantSquare.boardCol)
+    };
+    for (BoardSquare const &fromSquare : fromSquares) {
+        PieceCode pieceCode = getPieceCodeAt(fromSquare);
+        if (!PieceCodeUtilities::isPieceOf(pieceCode, team, PieceType::PAWN)) {
+            continue;
+        }
+
+        PieceDirection pieceDirection = PieceCodeUtilities::getPieceDirection(pieceCode);
+        bool isVerticalPawn = pieceDirection == PieceDirection::NORTH || pieceDirection == PieceDirection::SOUTH;
+        if (isVerticalPawn != (fromSquare.boardRow == enPassantSquare.boardRow)) {
+            continue;
+        }
+
+        BoardSquare toSquare = isVerticalPawn
+            ? BoardSquare(fromSquare.boardRow + (pieceDirection == PieceDirection::NORTH ? -1 : 1), enPassantSquare.boardCol)
+            : BoardSquare(enPassantSquare.boardRow, fromSquare.boardCol + (pieceDirection == PieceDirection::WEST ? -1 : 1));
+        if (isSquareOnBoard(toSquare)) {
+            MoveKind moveKind = isVerticalPawn ? MoveKind::EN_PASSANT_SAME_ROW : MoveKind::EN_PASSANT_SAME_COL;
+            addPawnMoves(getSquareIndex(fromSquare), getSquareIndex(toSquare), pieceDirection, moveKind, false, true, moves);
+        }
+    }
+}
+
+/*
+ * Appends all pseudo legal moves originating from the BoardSquare argument to the MoveList argument
+ * A single Piece is generated through its Piece, which queries the BitboardChessBoardImpl square by square
+ */
+void BitboardChessBoardImpl::generateAllPseudoLegalMovesAtSquare(BoardSquare const &boardSquare, MoveList &moves) const {
+    if (isSquareOnBoard(boardSquare) && !isSquareEmpty(boardSquare)) {
+        PieceFactory::getPiece(getPieceCodeAt(boardSquare)).addMoves(*this, boardSquare, false, moves);
+    }
+}
+
+/*
+ * True if the square index argument is attacked by any of the attacking Pieces argument, with the occupied squares argument blocking sliders
+ * The arguments need not match the BitboardChessBoardImpl, so that a move can be tested without making it
+ */
+bool BitboardChessBoardImpl::isSquareIndexAttacked(int squareIndex, Bitboard const &occupancy, Bitboard const &attackingPieces) const {
+    BitboardGeometry const &geometry = *bitboardGeometry;
+    Bitboard const &pawns = pieceTypeOccupancy[static_cast<int>(PieceType::PAWN)];
+    Bitboard const &knights = pieceTypeOccupancy[static_cast<int>(PieceType::KNIGHT)];
+    Bitboard const &kings = pieceTypeOccupancy[static_cast<int>(PieceType::KING)];
+    Bitboard const &bishops = pieceTypeOccupancy[static_cast<int>(PieceType::BISHOP)];
+    Bitboard const &rooks = pieceTypeOccupancy[static_cast<int>(PieceType::ROOK)];
+    Bitboard const &queens = pieceTypeOccupancy[static_cast<int>(PieceType::QUEEN)];
+
+    // Pawns, which attack a square from where a Pawn of the opposite PieceDirection on it would attack
+    if (
+        geometry.getPawnAttacks(squareIndex, PieceDirection::SOUTH).intersects(pawns & attackingPieces, pieceDirectionOccupancy[static_cast<int>(PieceDirection::NORTH)]) ||
+        geometry.getPawnAttacks(squareIndex, PieceDirection::NORTH).intersects(pawns & attackingPieces, pieceDirectionOccupancy[static_cast<int>(PieceDirection::SOUTH)]) ||
+        geometry.getPawnAttacks(squareIndex, PieceDirection::WEST).intersects(pawns & attackingPieces, pieceDirectionOccupancy[static_cast<int>(PieceDirection::EAST)]) ||
+        geometry.getPawnAttacks(squareIndex, PieceDirection::EAST).intersects(pawns & attackingPieces, pieceDirectionOccupancy[static_cast<int>(PieceDirection::WEST)])) {
+        return true;
+    }
+
+    // Leapers: Knights, Kings, and the extra jumps and steps of AdvancedQueens, AdvancedKnights, AdvancedKings, AdvancedBishops, AdvancedRooks
+    if (geometry.getLeaperAttacks(squareIndex, BoardGeometry::LeaperPattern::KNIGHT).intersects(knights, attackingPieces) ||
+        geometry.getLeaperAttacks(squareIndex, BoardGeometry::LeaperPattern::KING).intersects(kings, attackingPieces)) {
+        return true;
+    }
+    Bitboard advancedAttackingPieces = advancedOccupancy & attackingPieces;
+    if (!advancedAttackingPieces.isEmpty() && (
+        geometry.getLeaperAttacks(squareIndex, BoardGeometry::LeaperPattern::KNIGHT).intersects(queens, advancedAttackingPieces) ||
+        geometry.getLeaperAttacks(squareIndex, BoardGeometry::LeaperPattern::LONG_KNIGHT).intersects(knights, advancedAttackingPieces) ||
+        geometry.getLeaperAttacks(squareIndex, BoardGeometry::LeaperPattern::DIAGONAL_JUMP).intersects(kings, advancedAttackingPieces) ||
+        geometry.getLeaperAttacks(squareIndex, BoardGeometry::LeaperPattern::ORTHOGONAL_STEP).intersects(bishops, advancedAttackingPieces) ||
+        geometry.getLeaperAttacks(squareIndex, BoardGeometry::LeaperPattern::DIAGONAL_STEP).intersects(rooks, advancedAttackingPieces))) {
+        return true;
+    }
+
+    // Sliders, each attacking along a ray only if it is the first occupied square on it
+    Bitboard queenAttackingPieces = queens & attackingPieces;
+    return
+        geometry.isAttackedByOrthogonalSlider(squareIndex, occupancy, (rooks & attackingPieces) |= queenAttackingPieces) ||
+        geometry.isAttackedByDiagonalSlider(squareIndex, occupancy, (bishops & attackingPieces) |= queenAttackingPieces);
+}
+
+/*
+ * True if the pseudo legal move represented by the MoveCode argument does not leave a King of the Team argument attacked, false otherwise
+ * The occupied squares and the attacking Pieces are adjusted for the move, and every King of the Team is tested against them
+ */
+bool BitboardChessBoardImpl::isPseudoLegalMoveLegal(MoveCode moveCode, Team team) const {
+    int teamIndex = getTeamIndex(team);
+    int fromSquareIndex = MoveCodeUtilities::getFromSquareIndex(moveCode);
+    int toSquareIndex = MoveCodeUtilities::getToSquareIndex(moveCode);
+    int captureSquareIndex = getSquareIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard));
+
+    Bitboard occupancy = getOccupancy();
+    occupancy.reset(fromSquareIndex);
+    occupancy.reset(captureSquareIndex);
+    occupancy.set(toSquareIndex);
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        occupancy.reset(getSquareIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard)));
+        occupancy.set(getSquareIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard)));
+    }
+
+    Bitboard attackingPieces = teamOccupancy[1 - teamIndex];
+    attackingPieces.reset(captureSquareIndex);
+    attackingPieces.reset(toSquareIndex);       // Differs from the capture square for en passant onto an occupied square, whose occupant is overwritten
+
+    Bitboard kings = teamOccupancy[teamIndex] & pieceTypeOccupancy[static_cast<int>(PieceType::KING)];
+    if (kings.test(fromSquareIndex)) {
+        kings.reset(fromSquareIndex);
+        kings.set(toSquareIndex);
+    }
+    while (!kings.isEmpty()) {
+        int kingSquareIndex = kings.getLowestSquareIndex();
+        kings.reset(kingSquareIndex);
+        if (isSquareIndexAttacked(kingSquareIndex, occupancy, attackingPieces)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Removes the illegal moves from the MoveList argument in place, keeping the order of the legal ones
+ * Only moves from firstMoveIndex onward are filtered, and they must all be pseudo legal moves of the Team argument
+ * While the Team is not in check, a standard move of a Piece other than a King that does not start on a ray from one of its Kings
+ * towards a slider of the other Team cannot expose a King, so it is legal without testing the Kings
+ */
+void BitboardChessBoardImpl::filterLegalMoves(MoveList &moves, int firstMoveIndex, Team team) const {
+    int teamIndex = getTeamIndex(team);
+    Bitboard kings = teamOccupancy[teamIndex] & pieceTypeOccupancy[static_cast<int>(PieceType::KING)];
+    Bitboard kingLines;
+    if (!isInCheck(team)) {
+        Bitboard const &otherTeamOccupancy = teamOccupancy[1 - teamIndex];
+        Bitboard queens = pieceTypeOccupancy[static_cast<int>(PieceType::QUEEN)] & otherTeamOccupancy;
+        Bitboard orthogonalSliders = (pieceTypeOccupancy[static_cast<int>(PieceType::ROOK)] & otherTeamOccupancy) |= queens;
+        Bitboard diagonalSliders = (pieceTypeOccupancy[static_cast<int>(PieceType::BISHOP)] & otherTeamOccupancy) |= queens;
+        kingLines = kings;
+        kings.forEachSquareIndex([&](int kingSquareIndex) { kingLines |= bitboardGeometry->getSliderLines(kingSquareIndex, orthogonalSliders, diagonalSliders); });
+    } else {
+        kingLines = bitboardGeometry->getBoardMask();
+    }
+
+    int numLegalMoves = firstMoveIndex;
+    for (int moveIndex = firstMoveIndex; moveIndex < moves.size(); ++moveIndex) {
+        MoveCode moveCode = moves[moveIndex];
+        bool isMoveLegal =
+            (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::STANDARD && !kingLines.test(MoveCodeUtilities::getFromSquareIndex(moveCode))) ||
+            isPseudoLegalMoveLegal(moveCode, team);
+        if (isMoveLegal) {
+            moves[numLegalMoves++] = moveCode;
+        }
+    }
+    moves.truncate(numLegalMoves);
+}
+
+/*
+ * Rebuilds the piece lists of the Team argument from its Bitboards, in square index order
+ */
+void BitboardChessBoardImpl::refreshPieceSquares(Team team) const {
+    int teamIndex = getTeamIndex(team);
+    pieceSquares[teamIndex].clear();
+    kingSquares[teamIndex].clear();
+    teamOccupancy[teamIndex].forEachSquareIndex([&](int squareIndex) {
+        pieceSquares[teamIndex].emplace_back(getBoardSquare(squareIndex));
+        if (pieceTypeOccupancy[static_cast<int>(PieceType::KING)].test(squareIndex)) {
+            kingSquares[teamIndex].emplace_back(getBoardSquare(squareIndex));
+        }
+    });
+    arePieceSquaresValid[teamIndex] = true;
+}
+
+/*
+ * True if Team argument has a legal move available to make, false otherwise
+ */
+bool BitboardChessBoardImpl::canMakeMove(Team team) const {
+    MovePicker movePicker(*this, team);
+    return movePicker.next().has_value();
+}
+
+/*
+ * True if BoardMove argument would apply check after being made, false otherwise
+ */
+bool BitboardChessBoardImpl::doesMoveApplyCheck(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team otherTeam = getOtherTeam(getPieceDataAt(boardMove->getFromSquare()).value().team);
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
+
+    return isInCheck(otherTeam);
+}
+
+/*
+ * True if BoardMove argument would capture a piece after being made, false otherwise
+ */
+bool BitboardChessBoardImpl::doesMoveCapturePiece(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
+    std::optional<PieceData> attackedPieceData = getPieceDataAt(boardMove->getCaptureSquare());
+
+    return attackedPieceData.has_value() && attackedPieceData.value().team != movedPieceTeam;
+}
+
+/*
+ * True if BoardMove argument would leave a piece on it's own team attacked after being made, false otherwise
+ */
+bool BitboardChessBoardImpl::doesMoveLeavePieceAttacked(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
+
+    MoveList replyMoves;
+    generateAllLegalMoves(getOtherTeam(movedPieceTeam), replyMoves);
+    return std::any_of(replyMoves.begin(), replyMoves.end(), [](MoveCode replyMove) { return MoveCodeUtilities::isCapture(replyMove); });
+}
+
+/*
+ * True if BoardMove argument would win the game after being made, false otherwise
+ */
+bool BitboardChessBoardImpl::doesMoveWinGame(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
+
+    return isInCheckMate(getOtherTeam(movedPieceTeam));
+}
+
+
+#pragma mark - ChessBoard Interface Implementation
+
+/*
+ * Create PieceData Optional
+ * - value if Piece exists at BoardSquare argument
+ * - nullopt otherwise
+ */
+std::optional<PieceData> BitboardChessBoardImpl::getPieceDataAtImpl(BoardSquare const &boardSquare) const {
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode)
+        ? std::make_optional<PieceData>(PieceCodeUtilities::decode(pieceCode))
+        : std::nullopt;
+}
+
+/*
+ * Create PieceInfo Optional
+ * - value if Piece exists at BoardSquare argument
+ * - nullopt otherwise
+ */
+std::optional<PieceInfo> BitboardChessBoardImpl::getPieceInfoAtImpl(BoardSquare const &boardSquare) const {
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode)
+        ? std::make_optional<PieceInfo>(PieceFactory::getPiece(pieceCode).getPieceInfo())
+        : std::nullopt;
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard, false otherwise
+ */
+bool BitboardChessBoardImpl::isSquareOnBoardImpl(BoardSquare const &boardSquare) const {
+    return
+        static_cast<unsigned int>(boardSquare.boardRow) < static_cast<unsigned int>(numRowsOnBoard) &&
+        static_cast<unsigned int>(boardSquare.boardCol) < static_cast<unsigned int>(numColsOnBoard);
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and there is no Piece at that location, false otherwise
+ */
+bool BitboardChessBoardImpl::isSquareEmptyImpl(BoardSquare const &boardSquare) const {
+    return getPieceCodeAt(boardSquare) == EMPTY_PIECE_CODE;
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and the Team of The Piece at that location is equal to the Team argument, false otherwise
+ */
+bool BitboardChessBoardImpl::isSquareSameTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const {
+    return isSquareOnBoard(boardSquare) && teamOccupancy[getTeamIndex(ownTeam)].test(getSquareIndex(boardSquare));
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and the Team of The Piece at that location is not equal to the Team argument, false otherwise
+ */
+bool BitboardChessBoardImpl::isSquareOtherTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const {
+    return isSquareOnBoard(boardSquare) && teamOccupancy[getTeamIndex(getOtherTeam(ownTeam))].test(getSquareIndex(boardSquare));
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and that location is attacked by the Team opposite to the Team argument, false otherwise
+ */
+bool BitboardChessBoardImpl::isSquareAttackedImpl(BoardSquare const &boardSquare, Team ownTeam) const {
+    return
+        isSquareOnBoard(boardSquare) &&
+        isSquareIndexAttacked(getSquareIndex(boardSquare), getOccupancy(), teamOccupancy[getTeamIndex(getOtherTeam(ownTeam))]);
+}
+
+/*
+ * True if Team argument is in check, false otherwise
+ */
+bool BitboardChessBoardImpl::isInCheckImpl(Team team) const {
+    int teamIndex = getTeamIndex(team);
+    Bitboard occupancy = getOccupancy();
+    Bitboard kings = teamOccupancy[teamIndex] & pieceTypeOccupancy[static_cast<int>(PieceType::KING)];
+    while (!kings.isEmpty()) {
+        int kingSquareIndex = kings.getLowestSquareIndex();
+        kings.reset(kingSquareIndex);
+        if (isSquareIndexAttacked(kingSquareIndex, occupancy, teamOccupancy[1 - teamIndex])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * True if Team argument is in checkmate, false otherwise
+ */
+bool BitboardChessBoardImpl::isInCheckMateImpl(Team team) const {
+    return isInCheck(team) && !canMakeMove(team);
+}
+
+/*
+ * True if Team argument is in stalemate, false otherwise
+ */
+bool BitboardChessBoardImpl::isInStaleMateImpl(Team team) const {
+    return !isInCheck(team) && !canMakeMove(team);
+}
+
+/*
+ * Appends all legal moves originating from the BoardSquare argument to the MoveList argument
+ */
+void BitboardChessBoardImpl::generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const {
+    int firstMoveIndex = moves.size();
+    generateAllPseudoLegalMovesAtSquare(boardSquare, moves);
+    if (moves.size() > firstMoveIndex) {
+        filterLegalMoves(moves, firstMoveIndex, PieceCodeUtilities::getTeam(getPieceCodeAt(boardSquare)));
+    }
+}
+
+/*
+ * Appends all legal moves that can be made by the Team argument to the MoveList argument
+ */
+void BitboardChessBoardImpl::generateAllLegalMovesImpl(Team team, MoveList &moves) const {
+    int firstMoveIndex = moves.size();
+    generateAllPseudoLegalMoves(team, moves);
+    filterLegalMoves(moves, firstMoveIndex, team);
+}
+
+/*
+ * Appends all pseudo legal moves that can be made by the Team argument to the MoveList argument
+ * - Pawns a PieceDirection at a time, then en passant captures
+ * - Knights, Bishops, Rooks and Queens a Piece at a time, from their attacked squares less those of their own Team
+ * - Kings through their Piece
+ */
+void BitboardChessBoardImpl::generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const {
+    BitboardGeometry const &geometry = *bitboardGeometry;
+    int teamIndex = getTeamIndex(team);
+    Bitboard const &ownOccupancy = teamOccupancy[teamIndex];
+    Bitboard const &otherTeamOccupancy = teamOccupancy[1 - teamIndex];
+    Bitboard occupancy = getOccupancy();
+
+    // Pawns
+    for (PieceDirection pieceDirection : { PieceDirection::NORTH, PieceDirection::SOUTH, PieceDirection::EAST, PieceDirection::WEST }) {
+        generatePawnMoves(team, pieceDirection, moves);
+    }
+    generateEnPassantMoves(team, moves);
+
+    // Knights, Bishops, Rooks, Queens
+    Bitboard pieces = ownOccupancy;
+    pieces.andNot(pieceTypeOccupancy[static_cast<int>(PieceType::PAWN)]);
+    pieces.andNot(pieceTypeOccupancy[static_cast<int>(PieceType::KING)]);
+    pieces.forEachSquareIndex([&](int fromSquareIndex) {
+        bool isAdvanced = advancedOccupancy.test(fromSquareIndex);
+        Bitboard targets;
+        switch (PieceCodeUtilities::getPieceType(squares[fromSquareIndex])) {
+            case PieceType::KNIGHT:
+                targets = geometry.getLeaperAttacks(fromSquareIndex, BoardGeometry::LeaperPattern::KNIGHT);
+                if (isAdvanced) {
+                    targets |= geometry.getLeaperAttacks(fromSquareIndex, BoardGeometry::LeaperPattern::LONG_KNIGHT);
+                }
+                break;
+            case PieceType::BISHOP:
+                targets = geometry.getDiagonalAttacks(fromSquareIndex, occupancy);
+                if (isAdvanced) {
+                    targets |= geometry.getLeaperAttacks(fromSquareIndex, BoardGeometry::LeaperPattern::ORTHOGONAL_STEP);
+                }
+                break;
+            case PieceType::ROOK:
+                targets = geometry.getOrthogonalAttacks(fromSquareIndex, occupancy);
+                if (isAdvanced) {
+                    targets |= geometry.getLeaperAttacks(fromSquareIndex, BoardGeometry::LeaperPattern::DIAGONAL_STEP);
+                }
+                break;
+            case PieceType::QUEEN:
+                targets = geometry.getOrthogonalAttacks(fromSquareIndex, occupancy) |= geometry.getDiagonalAttacks(fromSquareIndex, occupancy);
+                if (isAdvanced) {
+                    targets |= geometry.getLeaperAttacks(fromSquareIndex, BoardGeometry::LeaperPattern::KNIGHT);
+                }
+                break;
+            default:
+                assert(false);
+        }
+        targets.andNot(ownOccupancy);
+        addTargetMoves(fromSquareIndex, targets, otherTeamOccupancy, moves);
+    });
+
+    // Kings
+    (ownOccupancy & pieceTypeOccupancy[static_cast<int>(PieceType::KING)]).forEachSquareIndex([&](int kingSquareIndex) {
+        PieceFactory::getPiece(squares[kingSquareIndex]).addMoves(*this, getBoardSquare(kingSquareIndex), false, moves);
+    });
+}
+
+/*
+ * True if the pseudo legal move represented by the MoveCode argument does not leave its own King attacked, false otherwise
+ */
+bool BitboardChessBoardImpl::isPseudoLegalMoveLegalImpl(MoveCode moveCode) const {
+    return isPseudoLegalMoveLegal(moveCode, PieceCodeUtilities::getTeam(squares[MoveCodeUtilities::getFromSquareIndex(moveCode)]));
+}
+
+/*
+ * Generate all legal moves that apply check that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> BitboardChessBoardImpl::generateCheckApplyingMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> checkApplyingBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (doesMoveApplyCheck(legalBoardMove)) {
+            checkApplyingBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return checkApplyingBoardMoves;
+}
+
+/*
+ * Generate all legal moves that capture a Piece that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> BitboardChessBoardImpl::generateCapturingMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> capturingBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (doesMoveCapturePiece(legalBoardMove)) {
+            capturingBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return capturingBoardMoves;
+}
+
+/*
+ * Generate all legal moves that don't leave a Piece of it's own Team in a position to be captured that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> BitboardChessBoardImpl::generateCaptureAvoidingMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> captureAvoidingBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (!doesMoveLeavePieceAttacked(legalBoardMove)) {
+            captureAvoidingBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return captureAvoidingBoardMoves;
+}
+
+/*
+ * Generate all legal moves that win the game that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> BitboardChessBoardImpl::generateWinningMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> winningBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (doesMoveWinGame(legalBoardMove)) {
+            winningBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return winningBoardMoves;
+}
+
+/*
+ * Generate all legal moves that can be made by the Team argument, each tagged with the MoveFlags that describe it
+ * Every move is made in place once, and the other Team's legal replies are generated once, to decide all of its MoveFlags
+ */
+std::vector<ClassifiedMove> BitboardChessBoardImpl::generateClassifiedMovesImpl(Team team) const {
+    std::vector<ClassifiedMove> classifiedMoves;
+    Team otherTeam = getOtherTeam(team);
+
+    MoveList legalMoves;
+    generateAllLegalMoves(team, legalMoves);
+    classifiedMoves.reserve(legalMoves.size());
+    for (MoveCode legalMove : legalMoves) {
+        MoveFlags moveFlags = MoveCodeUtilities::isCapture(legalMove) ? CAPTURES_PIECE_FLAG : NO_MOVE_FLAGS;
+        ScopedBoardMove scopedBoardMove(*this, legalMove);
+
+        MoveList replyMoves;
+        generateAllLegalMoves(otherTeam, replyMoves);
+        if (isInCheck(otherTeam)) {
+            moveFlags |= APPLIES_CHECK_FLAG;
+            if (replyMoves.empty()) {
+                moveFlags |= WINS_GAME_FLAG;
+            }
+        }
+        if (std::any_of(replyMoves.begin(), replyMoves.end(), [](MoveCode replyMove) { return MoveCodeUtilities::isCapture(replyMove); })) {
+            moveFlags |= LEAVES_PIECE_ATTACKED_FLAG;
+        }
+        classifiedMoves.emplace_back(legalMove, moveFlags);
+    }
+    return classifiedMoves;
+}
+
+/*
+ * Set the Piece at the BoardSquare argument location based on the PieceData argument
+ */
+void BitboardChessBoardImpl::setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) {
+    setPieceCodeAt(getSquareIndex(boardSquare), PieceCodeUtilities::encode(pieceData));
+}
+
+/*
+ * Clear the BoardSqure argument location of any Pieces
+ */
+void BitboardChessBoardImpl::clearPositionImpl(BoardSquare const &boardSquare) {
+    setPieceCodeAt(getSquareIndex(boardSquare), EMPTY_PIECE_CODE);
+}
+
+/*
+ * Clear the entire ChessBoard of any pieces
+ */
+void BitboardChessBoardImpl::clearBoardImpl() {
+    for (ChessBoard::BoardSquareIterator it = this->begin(); it != this->end(); ++it) {
+        clearPosition(*it);
+    }
+}
+
+/*
+ * Create BoardMove Optional
+ * - value if arguments match a legal BoardMove with the current ChessBoard state
+ * - nullopt otherwise
+ */
+std::optional<std::unique_ptr<BoardMove>> BitboardChessBoardImpl::createBoardMoveImpl(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType) const {
+    if (!isSquareOnBoard(fromSquare)) {
+        return std::nullopt;
+    }
+
+    MoveList legalMoves;
+    generateAllLegalMovesAtSquare(fromSquare, legalMoves);
+    for (MoveCode legalMove : legalMoves) {
+        if (toSquare == MoveCodeUtilities::getToSquare(legalMove, numColsOnBoard) &&
+            promotionPieceType == MoveCodeUtilities::getPromotionPieceType(legalMove)) {
+
+            return MoveCodeUtilities::decode(legalMove, *this);
+        }
+    }
+    return std::nullopt;
+}
+
+/*
+ * True if the BoardMove argument is a legal move with the current ChessBoard state, false otherwise
+ */
+bool BitboardChessBoardImpl::isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove) const {
+    if (isSquareOnBoard(boardMove->getFromSquare())) {
+        std::vector<std::unique_ptr<BoardMove>> pieceBoardMoves = generateAllLegalMovesAtSquare(boardMove->getFromSquare());
+        if (std::find_if(pieceBoardMoves.begin(), pieceBoardMoves.end(), [&boardMove](std::unique_ptr<BoardMove> const& pieceBoardMove) { return *pieceBoardMove == *boardMove; }) != pieceBoardMoves.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Apply the BoardMove argument to the ChessBoard
+ */
+void BitboardChessBoardImpl::makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) {
+    makeMoveImpl(MoveCodeUtilities::encode(*boardMove, *this));
+}
+
+/*
+ * Apply the move represented by the MoveCode argument to the ChessBoard
+ */
+void BitboardChessBoardImpl::makeMoveImpl(MoveCode moveCode) {
+    undoRecords.emplace_back(applyMove(moveCode));                                  // Apply the move and track it for undoing
+    clearRedoMoves();                                                               // Clear redo moves (can't redo after making a move)
+}
+
+/*
+ * Undo the last made move
+ * - True if move available to be undone
+ * - False otherwise (and BoardState remains unchanged)
+ */
+bool BitboardChessBoardImpl::undoMoveImpl() {
+    if (undoRecords.empty()) {
+        return false;
+    } else {
+        UndoRecord const &lastUndoRecord = undoRecords.back();                      // Get the record of the last made move
+        revertMove(lastUndoRecord);                                                 // Undo the move
+        redoMoveCodes.emplace_back(lastUndoRecord.moveCode);                        // Push it to the redo moves stack
+        undoRecords.pop_back();                                                     // Pop it off the undo stack
+        return true;
+    }
+}
+
+/*
+ * Redo the last undone move
+ * - True if move available to be redone
+ * - False otherwise (and BoardState remains unchanged)
+ */
+bool BitboardChessBoardImpl::redoMoveImpl() {
+    if (redoMoveCodes.empty()) {
+        return false;
+    } else {
+        MoveCode lastUndoneMoveCode = redoMoveCodes.back();                         // Get the last move to be undone
+        redoMoveCodes.pop_back();                                                   // Pop it off the redo moves stack
+        undoRecords.emplace_back(applyMove(lastUndoneMoveCode));                    // Apply the move and track it for undoing
+        return true;
+    }
+}
+
+/*
+ * Copy the position into a new ChessBoard, leaving the move history behind
+ */
+std::unique_ptr<ChessBoard> BitboardChessBoardImpl::clonePositionImpl() const {
+    return std::unique_ptr<ChessBoard>(new BitboardChessBoardImpl(*this, false));
+}
+
+/*
+ * Set the Team whose turn it is to move, keeping the position hash in sync
+ */
+void BitboardChessBoardImpl::setTeamToMoveImpl(Team team) {
+    if (team != positionState.teamToMove) {
+        positionHash ^= zobristKeys->getSideToMoveKey();
+        positionState.teamToMove = team;
+    }
+}
+
+/*
+ * Returns the locations of every Piece of the Team argument, rebuilt from the Bitboards if they changed since the last call
+ */
+std::vector<BoardSquare> const& BitboardChessBoardImpl::getPieceSquaresImpl(Team team) const {
+    if (!arePieceSquaresValid[getTeamIndex(team)]) {
+        refreshPieceSquares(team);
+    }
+    return pieceSquares[getTeamIndex(team)];
+}
+
+/*
+ * Returns the locations of every King of the Team argument, rebuilt from the Bitboards if they changed since the last call
+ */
+std::vector<BoardSquare> const& BitboardChessBoardImpl::getKingSquaresImpl(Team team) const {
+    if (!arePieceSquaresValid[getTeamIndex(team)]) {
+        refreshPieceSquares(team);
+    }
+    return kingSquares[getTeamIndex(team)];
+}
+
+/* Getters */
+std::optional<BoardSquare> BitboardChessBoardImpl::getEnPassantSquareImpl() const { return positionState.enPassantSquare; }
+int BitboardChessBoardImpl::getHalfmoveClockImpl() const { return positionState.halfmoveClock; }
+std::uint64_t BitboardChessBoardImpl::getPositionHashImpl() const { return positionHash; }
+BoardGeometry const& BitboardChessBoardImpl::getBoardGeometryImpl() const { return *boardGeometry; }
+Team BitboardChessBoardImpl::getTeamToMoveImpl() const { return positionState.teamToMove; }
+Team BitboardChessBoardImpl::getTeamOneImpl() const { return teamOne; }
+Team BitboardChessBoardImpl::getTeamTwoImpl() const { return teamTwo; }
+int BitboardChessBoardImpl::getNumRowsOnBoardImpl() const { return numRowsOnBoard; }
+int BitboardChessBoardImpl::getNumColsOnBoardImpl() const { return numColsOnBoard; }
+
+/* BoardSquareIterator */
+ChessBoard::BoardSquareIterator BitboardChessBoardImpl::beginImpl() { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator BitboardChessBoardImpl::beginImpl() const { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator BitboardChessBoardImpl::cbeginImpl() const { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator BitboardChessBoardImpl::endImpl() { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator BitboardChessBoardImpl::endImpl() const { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator BitboardChessBoardImpl::cendImpl() const { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+
+/* ReverseBoardSquareIterator */
+ChessBoard::ReverseBoardSquareIterator BitboardChessBoardImpl::rbeginImpl() { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator BitboardChessBoardImpl::rbeginImpl() const { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator BitboardChessBoardImpl::crbeginImpl() const { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator BitboardChessBoardImpl::rendImpl() { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator BitboardChessBoardImpl::rendImpl() const { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator BitboardChessBoardImpl::crendImpl() const { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
@@ -0,0 +1,240 @@
+// BitboardGeometry.cc
+
+#include "BitboardGeometry.h"
+
+#include <array>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "Bitboard.h"
+#include "BoardGeometry.h"
+#include "BoardSquare.h"
+#include "Constants.h"
+#include "MoveDirection.h"
+
+
+/*
+ * Basic ctor
+ * Leaper targets and rays are copied out of the BoardGeometry argument, Pawn attacks are found by shifting each square
+ */
+BitboardGeometry::BitboardGeometry(BoardGeometry const &boardGeometry) :
+    numRowsOnBoard(boardGeometry.getNumRowsOnBoard()), numColsOnBoard(boardGeometry.getNumColsOnBoard()) {
+
+    int numSquares = numRowsOnBoard * numColsOnBoard;
+    assert(numSquares <= Bitboard::numBits);
+    for (int squareIndex = 0; squareIndex < numSquares; ++squareIndex) {
+        boardMask.set(squareIndex);
+    }
+    for (int colDirection = -3; colDirection <= 3; ++colDirection) {
+        Bitboard &shiftSourceMask = shiftSourceMasks[colDirection + 3];
+        for (int squareIndex = 0; squareIndex < numSquares; ++squareIndex) {
+            int toCol = squareIndex % numColsOnBoard + colDirection;
+            if (0 <= toCol && toCol < numColsOnBoard) {
+                shiftSourceMask.set(squareIndex);
+            }
+        }
+    }
+
+    for (int patternIndex = 0; patternIndex < numLeaperPatterns; ++patternIndex) {
+        leaperAttacks[patternIndex].resize(numSquares);
+    }
+    for (int directionIndex = 0; directionIndex < numPieceDirections; ++directionIndex) {
+        pawnAttacks[directionIndex].resize(numSquares);
+    }
+    rays.resize(numSquares * numRayDirections);
+
+    for (int squareIndex = 0; squareIndex < numSquares; ++squareIndex) {
+        BoardSquare boardSquare(squareIndex / numColsOnBoard, squareIndex % numColsOnBoard);
+        for (int patternIndex = 0; patternIndex < numLeaperPatterns; ++patternIndex) {
+            for (BoardSquare const &toSquare : boardGeometry.getLeaperTargets(boardSquare, static_cast<BoardGeometry::LeaperPattern>(patternIndex))) {
+                leaperAttacks[patternIndex][squareIndex].set(toSquare.boardRow * numColsOnBoard + toSquare.boardCol);
+            }
+        }
+        for (int directionIndex = 0; directionIndex < numRayDirections; ++directionIndex) {
+            MoveDirection rayDirection(directionIndex / 3 - 1, directionIndex % 3 - 1);
+            if (rayDirection.rowDirection != 0 || rayDirection.colDirection != 0) {
+                for (BoardSquare const &raySquare : boardGeometry.getRay(boardSquare, rayDirection)) {
+                    rays[squareIndex * numRayDirections + directionIndex].set(raySquare.boardRow * numColsOnBoard + raySquare.boardCol);
+                }
+            }
+        }
+
+        Bitboard square;
+        square.set(squareIndex);
+        pawnAttacks[static_cast<int>(PieceDirection::NORTH)][squareIndex] = shiftSquares(square, -1, -1) | shiftSquares(square, -1, 1);
+        pawnAttacks[static_cast<int>(PieceDirection::SOUTH)][squareIndex] = shiftSquares(square, 1, -1) | shiftSquares(square, 1, 1);
+        pawnAttacks[static_cast<int>(PieceDirection::EAST)][squareIndex] = shiftSquares(square, -1, 1) | shiftSquares(square, 1, 1);
+        pawnAttacks[static_cast<int>(PieceDirection::WEST)][squareIndex] = shiftSquares(square, -1, -1) | shiftSquares(square, 1, -1);
+    }
+}
+
+/*
+ * Copy ctor
+ */
+BitboardGeometry::BitboardGeometry(BitboardGeometry const &other) :
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard), boardMask(other.boardMask), shiftSourceMasks(other.shiftSourceMasks),
+    leaperAttacks(other.leaperAttacks), pawnAttacks(other.pawnAttacks), rays(other.rays) { }
+
+/*
+ * Move ctor
+ */
+BitboardGeometry::BitboardGeometry(BitboardGeometry &&other) noexcept :
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard), boardMask(other.boardMask), shiftSourceMasks(other.shiftSourceMasks),
+    leaperAttacks(std::move(other.leaperAttacks)), pawnAttacks(std::move(other.pawnAttacks)), rays(std::move(other.rays)) { }
+
+/*
+ * Copy assignment
+ */
+BitboardGeometry& BitboardGeometry::operator=(BitboardGeometry const &other) {
+    if (this != &other) {
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        boardMask = other.boardMask;
+        shiftSourceMasks = other.shiftSourceMasks;
+        leaperAttacks = other.leaperAttacks;
+        pawnAttacks = other.pawnAttacks;
+        rays = other.rays;
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+BitboardGeometry& BitboardGeometry::operator=(BitboardGeometry &&other) noexcept {
+    if (this != &other) {
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        boardMask = other.boardMask;
+        shiftSourceMasks = other.shiftSourceMasks;
+        leaperAttacks = std::move(other.leaperAttacks);
+        pawnAttacks = std::move(other.pawnAttacks);
+        rays = std::move(other.rays);
+    }
+    return *this;
+}
+
+/*
+ * Returns the square index of the first occupied square along the ray of the direction index argument, -1 if there is none
+ * The first occupied square is the nearest one, which is the lowest square index for rays heading towards higher indices
+ */
+int BitboardGeometry::getNearestBlockerIndex(int squareIndex, int directionIndex, Bitboard const &occupancy) const {
+    Bitboard blockers = rays[squareIndex * numRayDirections + directionIndex] & occupancy;
+    if (blockers.isEmpty()) {
+        return -1;
+    }
+    return directionIndex > numRayDirections / 2
+        ? blockers.getLowestSquareIndex()
+        : blockers.getHighestSquareIndex();
+}
+
+/*
+ * Adds the squares along the ray of the direction index argument up to and including its first occupied square to the attacks argument
+ */
+void BitboardGeometry::addRayAttacks(int squareIndex, int directionIndex, Bitboard const &occupancy, Bitboard &attacks) const {
+    Bitboard const &ray = rays[squareIndex * numRayDirections + directionIndex];
+    int blockerIndex = getNearestBlockerIndex(squareIndex, directionIndex, occupancy);
+    if (blockerIndex < 0) {
+        attacks |= ray;
+    } else {
+        attacks |= ray ^ rays[blockerIndex * numRayDirections + directionIndex];
+    }
+}
+
+/*
+ * True if the first occupied square along the ray of the direction index argument is one of the sliders argument, false otherwise
+ * Rays holding none of the sliders are rejected before looking for the first occupied square
+ */
+bool BitboardGeometry::isRayAttacked(int squareIndex, int directionIndex, Bitboard const &occupancy, Bitboard const &sliders) const {
+    if (!rays[squareIndex * numRayDirections + directionIndex].intersects(sliders)) {
+        return false;
+    }
+    int blockerIndex = getNearestBlockerIndex(squareIndex, directionIndex, occupancy);
+    return blockerIndex >= 0 && sliders.test(blockerIndex);
+}
+
+/*
+ * Returns the Bitboard argument with every square moved by the row and col direction arguments (at most 3 cols)
+ * Squares that would leave the ChessBoard are dropped
+ */
+Bitboard BitboardGeometry::shiftSquares(Bitboard const &bitboard, int rowDirection, int colDirection) const {
+    Bitboard shiftedBitboard = (bitboard & shiftSourceMasks[colDirection + 3]).shifted(rowDirection * numColsOnBoard + colDirection);
+    return shiftedBitboard &= boardMask;
+}
+
+/*
+ * Returns the squares a single jump of the LeaperPattern argument away from the square index argument
+ */
+Bitboard const& BitboardGeometry::getLeaperAttacks(int squareIndex, BoardGeometry::LeaperPattern leaperPattern) const {
+    return leaperAttacks[static_cast<int>(leaperPattern)][squareIndex];
+}
+
+/*
+ * Returns the squares attacked by a Pawn of the PieceDirection argument at the square index argument
+ */
+Bitboard const& BitboardGeometry::getPawnAttacks(int squareIndex, PieceDirection pieceDirection) const {
+    return pawnAttacks[static_cast<int>(pieceDirection)][squareIndex];
+}
+
+/*
+ * Returns the squares attacked by a Rook at the square index argument, given the occupied squares argument
+ */
+Bitboard BitboardGeometry::getOrthogonalAttacks(int squareIndex, Bitboard const &occupancy) const {
+    Bitboard attacks;
+    addRayAttacks(squareIndex, 1, occupancy, attacks);
+    addRayAttacks(squareIndex, 3, occupancy, attacks);
+    addRayAttacks(squareIndex, 5, occupancy, attacks);
+    addRayAttacks(squareIndex, 7, occupancy, attacks);
+    return attacks;
+}
+
+/*
+ * Returns the squares attacked by a Bishop at the square index argument, given the occupied squares argument
+ */
+Bitboard BitboardGeometry::getDiagonalAttacks(int squareIndex, Bitboard const &occupancy) const {
+    Bitboard attacks;
+    addRayAttacks(squareIndex, 0, occupancy, attacks);
+    addRayAttacks(squareIndex, 2, occupancy, attacks);
+    addRayAttacks(squareIndex, 6, occupancy, attacks);
+    addRayAttacks(squareIndex, 8, occupancy, attacks);
+    return attacks;
+}
+
+/*
+ * Returns the squares along every ray from the square index argument that holds one of the sliders argument moving along it
+ * Only a Piece on one of these rays can be pinned to the square
+ */
+Bitboard BitboardGeometry::getSliderLines(int squareIndex, Bitboard const &orthogonalSliders, Bitboard const &diagonalSliders) const {
+    Bitboard sliderLines;
+    for (int directionIndex = 0; directionIndex < numRayDirections; ++directionIndex) {
+        Bitboard const &ray = rays[squareIndex * numRayDirections + directionIndex];
+        if (ray.intersects(directionIndex % 2 == 0 ? diagonalSliders : orthogonalSliders)) {
+            sliderLines |= ray;
+        }
+    }
+    return sliderLines;
+}
+
+/*
+ * True if one of the sliders argument attacks the square index argument along a row or col, given the occupied squares argument
+ */
+bool BitboardGeometry::isAttackedByOrthogonalSlider(int squareIndex, Bitboard const &occupancy, Bitboard const &sliders) const {
+    return
+        isRayAttacked(squareIndex, 1, occupancy, sliders) || isRayAttacked(squareIndex, 3, occupancy, sliders) ||
+        isRayAttacked(squareIndex, 5, occupancy, sliders) || isRayAttacked(squareIndex, 7, occupancy, sliders);
+}
+
+/*
+ * True if one of the sliders argument attacks the square index argument along a diagonal, given the occupied squares argument
+ */
+bool BitboardGeometry::isAttackedByDiagonalSlider(int squareIndex, Bitboard const &occupancy, Bitboard const &sliders) const {
+    return
+        isRayAttacked(squareIndex, 0, occupancy, sliders) || isRayAttacked(squareIndex, 2, occupancy, sliders) ||
+        isRayAttacked(squareIndex, 6, occupancy, sliders) || isRayAttacked(squareIndex, 8, occupancy, sliders);
+}
+
+/* Getters */
+Bitboard const& BitboardGeometry::getBoardMask() const { return boardMask; }
+int BitboardGeometry::getNumRowsOnBoard() const { return numRowsOnBoard; }
+int BitboardGeometry::getNumColsOnBoard() const { return numColsOnBoard; }
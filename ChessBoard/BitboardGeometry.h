@@ -0,0 +1,63 @@
+// BitboardGeometry.h
+
+#ifndef BitboardGeometry_h
+#define BitboardGeometry_h
+
+#include <array>
+#include <vector>
+
+#include "Bitboard.h"
+#include "BoardGeometry.h"
+#include "Constants.h"
+
+
+/**
+ * BitboardGeometry Class
+ * The tables of a BoardGeometry recast as Bitboards, for ChessBoards of a fixed size that generate moves a whole set of squares at a time
+ * - Per square and LeaperPattern, the squares a single jump away
+ * - Per square and PieceDirection, the squares a Pawn attacks
+ * - Per square and MoveDirection, the squares along the ray, so that slider attacks are found by masking with the occupied squares
+ */
+class BitboardGeometry final {
+private:
+    static int const numLeaperPatterns = 6;
+    static int const numPieceDirections = 4;
+    static int const numRayDirections = 9;     // Indexed by (rowDirection + 1) * 3 + (colDirection + 1), the null direction is always empty
+
+    int numRowsOnBoard;
+    int numColsOnBoard;
+    Bitboard boardMask;
+    std::array<Bitboard, 7> shiftSourceMasks;                                   // Indexed by colDirection + 3, squares that stay on their row when shifted that many cols
+    std::array<std::vector<Bitboard>, numLeaperPatterns> leaperAttacks;         // Per LeaperPattern, indexed by square index
+    std::array<std::vector<Bitboard>, numPieceDirections> pawnAttacks;          // Per PieceDirection, indexed by square index
+    std::vector<Bitboard> rays;                                                 // Indexed by square index * numRayDirections + direction index
+
+    int getNearestBlockerIndex(int squareIndex, int directionIndex, Bitboard const &occupancy) const;
+    void addRayAttacks(int squareIndex, int directionIndex, Bitboard const &occupancy, Bitboard &attacks) const;
+    bool isRayAttacked(int squareIndex, int directionIndex, Bitboard const &occupancy, Bitboard const &sliders) const;
+
+public:
+    explicit BitboardGeometry(BoardGeometry const &boardGeometry);
+    BitboardGeometry(BitboardGeometry const &other);
+    BitboardGeometry(BitboardGeometry &&other) noexcept;
+    BitboardGeometry& operator=(BitboardGeometry const &other);
+    BitboardGeometry& operator=(BitboardGeometry &&other) noexcept;
+    ~BitboardGeometry() = default;
+
+    Bitboard shiftSquares(Bitboard const &bitboard, int rowDirection, int colDirection) const;
+
+    Bitboard const& getLeaperAttacks(int squareIndex, BoardGeometry::LeaperPattern leaperPattern) const;
+    Bitboard const& getPawnAttacks(int squareIndex, PieceDirection pieceDirection) const;
+    Bitboard getOrthogonalAttacks(int squareIndex, Bitboard const &occupancy) const;
+    Bitboard getDiagonalAttacks(int squareIndex, Bitboard const &occupancy) const;
+    Bitboard getSliderLines(int squareIndex, Bitboard const &orthogonalSliders, Bitboard const &diagonalSliders) const;
+    bool isAttackedByOrthogonalSlider(int squareIndex, Bitboard const &occupancy, Bitboard const &sliders) const;
+    bool isAttackedByDiagonalSlider(int squareIndex, Bitboard const &occupancy, Bitboard const &sliders) const;
+
+    Bitboard const& getBoardMask() const;
+    int getNumRowsOnBoard() const;
+    int getNumColsOnBoard() const;
+};
+
+
+#endif /* BitboardGeometry_h */
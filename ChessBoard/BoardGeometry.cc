@@ -0,0 +1,203 @@
+// BoardGeometry.cc
+
+#include "BoardGeometry.h"
+
+#include <array>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "BoardSquare.h"
+#include "MoveDirection.h"
+
+
+#pragma mark - SquareRange
+
+/*
+ * Basic ctor
+ */
+BoardGeometry::SquareRange::SquareRange(BoardSquare const *first, BoardSquare const *last) :
+    first(first), last(last) { }
+
+/* Getters */
+BoardSquare const* BoardGeometry::SquareRange::begin() const { return first; }
+BoardSquare const* BoardGeometry::SquareRange::end() const { return last; }
+bool BoardGeometry::SquareRange::empty() const { return first == last; }
+
+
+#pragma mark - BoardGeometry
+
+/*
+ * Basic ctor
+ * Builds every table up front, off board targets and ray squares are left out
+ */
+BoardGeometry::BoardGeometry(int numRowsOnBoard, int numColsOnBoard) :
+    numRowsOnBoard(numRowsOnBoard), numColsOnBoard(numColsOnBoard) {
+
+    int numSquares = numRowsOnBoard * numColsOnBoard;
+    for (int patternIndex = 0; patternIndex < numLeaperPatterns; ++patternIndex) {
+        std::vector<MoveDirection> const &leaperDirections = getLeaperDirections(static_cast<LeaperPattern>(patternIndex));
+        leaperOffsets[patternIndex].reserve(numSquares + 1);
+        for (int boardRow = 0; boardRow < numRowsOnBoard; ++boardRow) {
+            for (int boardCol = 0; boardCol < numColsOnBoard; ++boardCol) {
+                leaperOffsets[patternIndex].push_back(leaperSquares[patternIndex].size());
+                for (MoveDirection const &leaperDirection : leaperDirections) {
+                    int toRow = boardRow + leaperDirection.rowDirection;
+                    int toCol = boardCol + leaperDirection.colDirection;
+                    if (isSquareOnBoard(toRow, toCol)) {
+                        leaperSquares[patternIndex].emplace_back(toRow, toCol);
+                    }
+                }
+            }
+        }
+        leaperOffsets[patternIndex].push_back(leaperSquares[patternIndex].size());
+    }
+
+    rayOffsets.reserve(numSquares * numRayDirections + 1);
+    for (int boardRow = 0; boardRow < numRowsOnBoard; ++boardRow) {
+        for (int boardCol = 0; boardCol < numColsOnBoard; ++boardCol) {
+            for (int directionIndex = 0; directionIndex < numRayDirections; ++directionIndex) {
+                rayOffsets.push_back(raySquares.size());
+                int rowDirection = directionIndex / 3 - 1;
+                int colDirection = directionIndex % 3 - 1;
+                if (rowDirection == 0 && colDirection == 0) {
+                    continue;
+                }
+                for (int toRow = boardRow + rowDirection, toCol = boardCol + colDirection; isSquareOnBoard(toRow, toCol); toRow += rowDirection, toCol += colDirection) {
+                    raySquares.emplace_back(toRow, toCol);
+                }
+            }
+        }
+    }
+    rayOffsets.push_back(raySquares.size());
+}
+
+/*
+ * Copy ctor
+ */
+BoardGeometry::BoardGeometry(BoardGeometry const &other) :
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard),
+    leaperSquares(other.leaperSquares), leaperOffsets(other.leaperOffsets), raySquares(other.raySquares), rayOffsets(other.rayOffsets) { }
+
+/*
+ * Move ctor
+ */
+BoardGeometry::BoardGeometry(BoardGeometry &&other) noexcept :
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard),
+    leaperSquares(std::move(other.leaperSquares)), leaperOffsets(std::move(other.leaperOffsets)), raySquares(std::move(other.raySquares)), rayOffsets(std::move(other.rayOffsets)) { }
+
+/*
+ * Copy assignment
+ */
+BoardGeometry& BoardGeometry::operator=(BoardGeometry const &other) {
+    if (this != &other) {
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        leaperSquares = other.leaperSquares;
+        leaperOffsets = other.leaperOffsets;
+        raySquares = other.raySquares;
+        rayOffsets = other.rayOffsets;
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+BoardGeometry& BoardGeometry::operator=(BoardGeometry &&other) noexcept {
+    if (this != &other) {
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        leaperSquares = std::move(other.leaperSquares);
+        leaperOffsets = std::move(other.leaperOffsets);
+        raySquares = std::move(other.raySquares);
+        rayOffsets = std::move(other.rayOffsets);
+    }
+    return *this;
+}
+
+/*
+ * Static
+ *
+ * Returns the jumps making up the LeaperPattern argument, in the order the Pieces using it have always generated their moves
+ */
+std::vector<MoveDirection> const& BoardGeometry::getLeaperDirections(LeaperPattern leaperPattern) {
+    static std::vector<MoveDirection> const kingDirections = {
+        MoveDirection(-1, -1), MoveDirection(-1, 0), MoveDirection(-1, 1), MoveDirection(0, -1),
+        MoveDirection(0, 1), MoveDirection(1, -1), MoveDirection(1, 0), MoveDirection(1, 1)
+    };
+    static std::vector<MoveDirection> const knightDirections = {
+        MoveDirection(-1, -2), MoveDirection(-1, 2), MoveDirection(1, -2), MoveDirection(1, 2),
+        MoveDirection(-2, -1), MoveDirection(-2, 1), MoveDirection(2, -1), MoveDirection(2, 1)
+    };
+    static std::vector<MoveDirection> const orthogonalStepDirections = {
+        MoveDirection(0, 1), MoveDirection(0, -1), MoveDirection(1, 0), MoveDirection(-1, 0)
+    };
+    static std::vector<MoveDirection> const diagonalStepDirections = {
+        MoveDirection(1, 1), MoveDirection(1, -1), MoveDirection(-1, 1), MoveDirection(-1, -1)
+    };
+    static std::vector<MoveDirection> const diagonalJumpDirections = {
+        MoveDirection(2, 2), MoveDirection(2, -2), MoveDirection(-2, 2), MoveDirection(-2, -2)
+    };
+    static std::vector<MoveDirection> const longKnightDirections = {
+        MoveDirection(1, 3), MoveDirection(1, -3), MoveDirection(-1, 3), MoveDirection(-1, -3),
+        MoveDirection(3, 1), MoveDirection(3, -1), MoveDirection(-3, 1), MoveDirection(-3, -1)
+    };
+
+    switch (leaperPattern) {
+        case LeaperPattern::KING:
+            return kingDirections;
+        case LeaperPattern::KNIGHT:
+            return knightDirections;
+        case LeaperPattern::ORTHOGONAL_STEP:
+            return orthogonalStepDirections;
+        case LeaperPattern::DIAGONAL_STEP:
+            return diagonalStepDirections;
+        case LeaperPattern::DIAGONAL_JUMP:
+            return diagonalJumpDirections;
+        case LeaperPattern::LONG_KNIGHT:
+            return longKnightDirections;
+    }
+    assert(false);
+    return kingDirections;
+}
+
+/*
+ * Returns the index of the BoardSquare argument, which must be on the board
+ */
+int BoardGeometry::getSquareIndex(BoardSquare const &boardSquare) const {
+    assert(isSquareOnBoard(boardSquare.boardRow, boardSquare.boardCol));
+    return boardSquare.boardRow * numColsOnBoard + boardSquare.boardCol;
+}
+
+/*
+ * True if the row and col arguments are on the board, false otherwise
+ */
+bool BoardGeometry::isSquareOnBoard(int boardRow, int boardCol) const {
+    return 0 <= boardRow && boardRow < numRowsOnBoard && 0 <= boardCol && boardCol < numColsOnBoard;
+}
+
+/*
+ * Returns the on board squares a single jump of the LeaperPattern argument away from the BoardSquare argument
+ */
+BoardGeometry::SquareRange BoardGeometry::getLeaperTargets(BoardSquare const &boardSquare, LeaperPattern leaperPattern) const {
+    int patternIndex = static_cast<int>(leaperPattern);
+    int squareIndex = getSquareIndex(boardSquare);
+    BoardSquare const *squares = leaperSquares[patternIndex].data();
+    return SquareRange(squares + leaperOffsets[patternIndex][squareIndex], squares + leaperOffsets[patternIndex][squareIndex + 1]);
+}
+
+/*
+ * Returns the on board squares along the MoveDirection argument from the BoardSquare argument, nearest first
+ * MoveDirection argument must be a single step, orthogonal or diagonal
+ */
+BoardGeometry::SquareRange BoardGeometry::getRay(BoardSquare const &boardSquare, MoveDirection const &moveDirection) const {
+    assert(-1 <= moveDirection.rowDirection && moveDirection.rowDirection <= 1 && -1 <= moveDirection.colDirection && moveDirection.colDirection <= 1);
+    int rayIndex = getSquareIndex(boardSquare) * numRayDirections + (moveDirection.rowDirection + 1) * 3 + (moveDirection.colDirection + 1);
+    BoardSquare const *squares = raySquares.data();
+    return SquareRange(squares + rayOffsets[rayIndex], squares + rayOffsets[rayIndex + 1]);
+}
+
+/* Getters */
+int BoardGeometry::getNumRowsOnBoard() const { return numRowsOnBoard; }
+int BoardGeometry::getNumColsOnBoard() const { return numColsOnBoard; }
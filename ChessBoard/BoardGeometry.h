@@ -0,0 +1,76 @@
+// BoardGeometry.h
+
+#ifndef BoardGeometry_h
+#define BoardGeometry_h
+
+#include <array>
+#include <vector>
+
+#include "BoardSquare.h"
+#include "MoveDirection.h"
+
+
+/**
+ * BoardGeometry Class
+ * Move and ray tables precomputed for ChessBoards of a fixed size, so that move generators iterate flat lists of on board squares
+ * - Per square and LeaperPattern, the on board squares a single jump away
+ * - Per square and MoveDirection, the on board squares along the ray, nearest first
+ */
+class BoardGeometry final {
+public:
+    enum class LeaperPattern { KING, KNIGHT, ORTHOGONAL_STEP, DIAGONAL_STEP, DIAGONAL_JUMP, LONG_KNIGHT };
+
+    /**
+     * SquareRange Class
+     * A view over a contiguous run of BoardSquares owned by a BoardGeometry
+     */
+    class SquareRange final {
+    private:
+        BoardSquare const *first;
+        BoardSquare const *last;
+
+    public:
+        explicit SquareRange(BoardSquare const *first, BoardSquare const *last);
+        SquareRange(SquareRange const &other) = default;
+        SquareRange(SquareRange &&other) noexcept = default;
+        SquareRange& operator=(SquareRange const &other) = default;
+        SquareRange& operator=(SquareRange &&other) noexcept = default;
+        ~SquareRange() = default;
+
+        BoardSquare const* begin() const;
+        BoardSquare const* end() const;
+        bool empty() const;
+    };
+
+private:
+    static int const numLeaperPatterns = 6;
+    static int const numRayDirections = 9;     // Indexed by (rowDirection + 1) * 3 + (colDirection + 1), the null direction is always empty
+
+    int numRowsOnBoard;
+    int numColsOnBoard;
+    std::array<std::vector<BoardSquare>, numLeaperPatterns> leaperSquares;     // Per LeaperPattern, the targets of every square back to back
+    std::array<std::vector<int>, numLeaperPatterns> leaperOffsets;             // Per LeaperPattern, indexed by square index, numSquares + 1 entries
+    std::vector<BoardSquare> raySquares;                                        // The rays of every square and direction back to back
+    std::vector<int> rayOffsets;                                                // Indexed by square index * numRayDirections + direction index
+
+    static std::vector<MoveDirection> const& getLeaperDirections(LeaperPattern leaperPattern);
+    int getSquareIndex(BoardSquare const &boardSquare) const;
+    bool isSquareOnBoard(int boardRow, int boardCol) const;
+
+public:
+    explicit BoardGeometry(int numRowsOnBoard, int numColsOnBoard);
+    BoardGeometry(BoardGeometry const &other);
+    BoardGeometry(BoardGeometry &&other) noexcept;
+    BoardGeometry& operator=(BoardGeometry const &other);
+    BoardGeometry& operator=(BoardGeometry &&other) noexcept;
+    ~BoardGeometry() = default;
+
+    SquareRange getLeaperTargets(BoardSquare const &boardSquare, LeaperPattern leaperPattern) const;
+    SquareRange getRay(BoardSquare const &boardSquare, MoveDirection const &moveDirection) const;
+
+    int getNumRowsOnBoard() const;
+    int getNumColsOnBoard() const;
+};
+
+
+#endif /* BoardGeometry_h */
@@ -2,16 +2,23 @@
 
 #include "ChessBoard.h"
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
 
+#include "BoardGeometry.h"
 #include "BoardMove.h"
 #include "BoardSquare.h"
+#include "ClassifiedMove.h"
 #include "Constants.h"
+#include "LegalMoveCache.h"
+#include "MoveCode.h"
+#include "MoveList.h"
 #include "PieceData.h"
 #include "PieceInfo.h"
+#include "PositionStatus.h"
 
 
 #pragma mark - BoardSquareIterator
@@ -204,19 +211,21 @@ ChessBoard::ChessBoard() { }
 /*
  * Copy ctor
  */
-ChessBoard::ChessBoard(ChessBoard const &other) { }
+ChessBoard::ChessBoard(ChessBoard const &other) :
+    legalMoveCache(other.legalMoveCache) { }
 
 /*
  * Move ctor
  */
-ChessBoard::ChessBoard(ChessBoard &&other) noexcept { }
+ChessBoard::ChessBoard(ChessBoard &&other) noexcept :
+    legalMoveCache(std::move(other.legalMoveCache)) { }
 
 /*
  * Copy assignment
  */
 ChessBoard& ChessBoard::operator=(ChessBoard const &other) {
     if (this != &other) {
-        return *this;
+        legalMoveCache = other.legalMoveCache;
     }
     return *this;
 }
@@ -226,11 +235,198 @@ ChessBoard& ChessBoard::operator=(ChessBoard const &other) {
  */
 ChessBoard& ChessBoard::operator=(ChessBoard &&other) noexcept {
     if (this != &other) {
-        return *this;
+        legalMoveCache = std::move(other.legalMoveCache);
     }
     return *this;
 }
 
+/*
+ * Returns the cached legal moves of the Team argument in the current position, generating and caching them on a miss
+ * Must not be called with the cache disabled
+ */
+LegalMoveCache::Entry const& ChessBoard::findOrGenerateLegalMoves(Team team) const {
+    std::uint64_t positionHash = getPositionHashImpl();
+    if (LegalMoveCache::Entry const *entry = legalMoveCache.find(positionHash, team)) {
+        return *entry;
+    }
+    MoveList moves;
+    generateAllLegalMovesImpl(team, moves);
+    return legalMoveCache.insert(positionHash, team, isInCheckImpl(team), moves);
+}
+
+/*
+ * Returns whether the Team argument is in check, how many legal moves it has and the resulting GameResult
+ * Computed with one legal move generation the first time it is asked for in a position, then served from the LegalMoveCache
+ */
+PositionStatus ChessBoard::getPositionStatus(Team team) const {
+    if (legalMoveCache.getCapacity() == 0) {
+        MoveList moves;
+        generateAllLegalMovesImpl(team, moves);
+        return PositionStatus(isInCheckImpl(team), moves.size());
+    }
+    LegalMoveCache::Entry const &entry = findOrGenerateLegalMoves(team);
+    return PositionStatus(entry.isInCheck, entry.moveCodes.size());
+}
+
+/*
+ * True if Team argument is in checkmate, false otherwise
+ * Answered from the LegalMoveCache when the position is cached, the search calls this on positions it never revisits
+ * so a miss falls through to the early exiting implementation rather than generating every legal move
+ */
+bool ChessBoard::isInCheckMate(Team team) const {
+    if (legalMoveCache.getCapacity() > 0) {
+        if (LegalMoveCache::Entry const *entry = legalMoveCache.find(getPositionHashImpl(), team)) {
+            return entry->isInCheck && entry->moveCodes.empty();
+        }
+    }
+    return isInCheckMateImpl(team);
+}
+
+/*
+ * True if Team argument is in stalemate, false otherwise
+ * Answered from the LegalMoveCache when the position is cached, see isInCheckMate
+ */
+bool ChessBoard::isInStaleMate(Team team) const {
+    if (legalMoveCache.getCapacity() > 0) {
+        if (LegalMoveCache::Entry const *entry = legalMoveCache.find(getPositionHashImpl(), team)) {
+            return !entry->isInCheck && entry->moveCodes.empty();
+        }
+    }
+    return isInStaleMateImpl(team);
+}
+
+/*
+ * Appends all legal moves originating from the BoardSquare argument to the MoveList argument
+ * Picked out of the cached legal moves of the Team of the Piece on the BoardSquare argument
+ */
+void ChessBoard::generateAllLegalMovesAtSquare(BoardSquare const &boardSquare, MoveList &moves) const {
+    if (legalMoveCache.getCapacity() == 0) {
+        generateAllLegalMovesAtSquareImpl(boardSquare, moves);
+        return;
+    }
+
+    std::optional<PieceData> pieceData = isSquareOnBoardImpl(boardSquare) ? getPieceDataAtImpl(boardSquare) : std::nullopt;
+    if (!pieceData.has_value()) {
+        return;
+    }
+
+    int fromSquareIndex = boardSquare.boardRow * getNumColsOnBoardImpl() + boardSquare.boardCol;
+    for (MoveCode moveCode : findOrGenerateLegalMoves(pieceData.value().team).moveCodes) {
+        if (MoveCodeUtilities::getFromSquareIndex(moveCode) == fromSquareIndex) {
+            moves.push_back(moveCode);
+        }
+    }
+}
+
+/*
+ * Generate all legal moves originating from the BoardSquare argument
+ * Adapter over the MoveList generator, for callers that need owning BoardMoves
+ */
+std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateAllLegalMovesAtSquare(BoardSquare const &boardSquare) const {
+    MoveList moves;
+    generateAllLegalMovesAtSquare(boardSquare, moves);
+    return decodeMoves(moves);
+}
+
+/*
+ * Generate all legal moves that can be made by the Team argument
+ * Adapter over the MoveList generator, for callers that need owning BoardMoves, served from the LegalMoveCache
+ */
+std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateAllLegalMoves(Team team) const {
+    if (legalMoveCache.getCapacity() == 0) {
+        MoveList moves;
+        generateAllLegalMovesImpl(team, moves);
+        return decodeMoves(moves);
+    }
+
+    std::vector<std::unique_ptr<BoardMove>> boardMoves;
+    LegalMoveCache::Entry const &entry = findOrGenerateLegalMoves(team);
+    boardMoves.reserve(entry.moveCodes.size());
+    for (MoveCode moveCode : entry.moveCodes) {
+        boardMoves.emplace_back(MoveCodeUtilities::decode(moveCode, *this));
+    }
+    return boardMoves;
+}
+
+/*
+ * Create BoardMove Optional
+ * - value if arguments match a legal BoardMove with the current ChessBoard state
+ * - nullopt otherwise
+ * Matched against the cached legal moves, so the legality check of a human move reuses the generation of the status queries
+ */
+std::optional<std::unique_ptr<BoardMove>> ChessBoard::createBoardMove(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType) const {
+    if (legalMoveCache.getCapacity() == 0) {
+        return createBoardMoveImpl(fromSquare, toSquare, promotionPieceType);
+    }
+
+    MoveList legalMoves;
+    generateAllLegalMovesAtSquare(fromSquare, legalMoves);
+    int numColsOnBoard = getNumColsOnBoardImpl();
+    for (MoveCode legalMove : legalMoves) {
+        if (toSquare == MoveCodeUtilities::getToSquare(legalMove, numColsOnBoard) && 
+            promotionPieceType == MoveCodeUtilities::getPromotionPieceType(legalMove)) {
+
+            return MoveCodeUtilities::decode(legalMove, *this);
+        }
+    }
+    return std::nullopt;
+}
+
+/*
+ * True if the BoardMove argument is a legal move with the current ChessBoard state, false otherwise
+ * Matched against the cached legal moves, see createBoardMove
+ */
+bool ChessBoard::isMoveLegal(std::unique_ptr<BoardMove> const &boardMove) const {
+    if (legalMoveCache.getCapacity() == 0) {
+        return isMoveLegalImpl(boardMove);
+    }
+
+    MoveList legalMoves;
+    generateAllLegalMovesAtSquare(boardMove->getFromSquare(), legalMoves);
+    for (MoveCode legalMove : legalMoves) {
+        if (*MoveCodeUtilities::decode(legalMove, *this) == *boardMove) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Copies the position without the move history
+ * The copy's LegalMoveCache starts out empty with the same capacity, as it does for every copy of a ChessBoard
+ */
+std::unique_ptr<ChessBoard> ChessBoard::clonePosition() const {
+    std::unique_ptr<ChessBoard> chessBoard = clonePositionImpl();
+    chessBoard->legalMoveCache = legalMoveCache;
+    return chessBoard;
+}
+
+/*
+ * Returns the LegalMoveCache, for its capacity and hit / miss counters
+ */
+LegalMoveCache const& ChessBoard::getLegalMoveCache() const {
+    return legalMoveCache;
+}
+
+/*
+ * Resizes the LegalMoveCache to the number of entries argument, dropping every cached position
+ */
+void ChessBoard::setLegalMoveCacheCapacity(int capacity) {
+    legalMoveCache.setCapacity(capacity);
+}
+
+/*
+ * Decodes every MoveCode in the MoveList argument into a BoardMove on this ChessBoard
+ */
+std::vector<std::unique_ptr<BoardMove>> ChessBoard::decodeMoves(MoveList const &moves) const {
+    std::vector<std::unique_ptr<BoardMove>> boardMoves;
+    boardMoves.reserve(moves.size());
+    for (MoveCode moveCode : moves) {
+        boardMoves.emplace_back(MoveCodeUtilities::decode(moveCode, *this));
+    }
+    return boardMoves;
+}
+
 /* Public Virtual Methods */
 std::unique_ptr<ChessBoard> ChessBoard::clone() const { return cloneImpl(); }
 
@@ -244,27 +440,35 @@ bool ChessBoard::isSquareOtherTeam(BoardSquare const &boardSquare, Team ownTeam)
 bool ChessBoard::isSquareAttacked(BoardSquare const &boardSquare, Team ownTeam) const { return isSquareAttackedImpl(boardSquare, ownTeam); }
 
 bool ChessBoard::isInCheck(Team team) const { return isInCheckImpl(team); }
-bool ChessBoard::isInCheckMate(Team team) const { return isInCheckMateImpl(team); }
-bool ChessBoard::isInStaleMate(Team team) const { return isInStaleMateImpl(team); }
 
-std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateAllLegalMovesAtSquare(BoardSquare const &boardSquare) const { return generateAllLegalMovesAtSquareImpl(boardSquare); }
-std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateAllLegalMoves(Team team) const { return generateAllLegalMovesImpl(team); }
+void ChessBoard::generateAllLegalMoves(Team team, MoveList &moves) const { generateAllLegalMovesImpl(team, moves); }
+void ChessBoard::generateAllPseudoLegalMoves(Team team, MoveList &moves) const { generateAllPseudoLegalMovesImpl(team, moves); }
+bool ChessBoard::isPseudoLegalMoveLegal(MoveCode moveCode) const { return isPseudoLegalMoveLegalImpl(moveCode); }
 std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateCheckApplyingMoves(Team team) const { return generateCheckApplyingMovesImpl(team); }
 std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateCapturingMoves(Team team) const { return generateCapturingMovesImpl(team); }
 std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateCaptureAvoidingMoves(Team team) const { return generateCaptureAvoidingMovesImpl(team); }
 std::vector<std::unique_ptr<BoardMove>> ChessBoard::generateWinningMoves(Team team) const { return generateWinningMovesImpl(team); }
+std::vector<ClassifiedMove> ChessBoard::generateClassifiedMoves(Team team) const { return generateClassifiedMovesImpl(team); }
 
-void ChessBoard::setPosition(BoardSquare const &boardSquare, PieceData const &pieceData) { return setPositionImpl(boardSquare, pieceData); }
-void ChessBoard::clearPosition(BoardSquare const &boardSquare) { return clearPositionImpl(boardSquare); }
+void ChessBoard::setPosition(BoardSquare const &boardSquare, PieceData const &pieceData) { setPositionImpl(boardSquare, pieceData); }
+void ChessBoard::clearPosition(BoardSquare const &boardSquare) { clearPositionImpl(boardSquare); }
 void ChessBoard::clearBoard() { clearBoardImpl(); }
 
-std::optional<std::unique_ptr<BoardMove>> ChessBoard::createBoardMove(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType) const { return createBoardMoveImpl(fromSquare, toSquare, promotionPieceType); }
-void ChessBoard::makeMove(std::unique_ptr<BoardMove> const &boardMove) { return makeMoveImpl(boardMove); }
-bool ChessBoard::isMoveLegal(std::unique_ptr<BoardMove> const &boardMove) const { return isMoveLegalImpl(boardMove); }
+void ChessBoard::makeMove(std::unique_ptr<BoardMove> const &boardMove) { makeMoveImpl(boardMove); }
+void ChessBoard::makeMove(MoveCode moveCode) { makeMoveImpl(moveCode); }
 bool ChessBoard::undoMove() { return undoMoveImpl(); }
 bool ChessBoard::redoMove() { return redoMoveImpl(); }
 
-std::vector<std::unique_ptr<BoardMove>> const& ChessBoard::getCompletedMoves() const { return getCompletedMovesImpl(); }
+std::optional<BoardSquare> ChessBoard::getEnPassantSquare() const { return getEnPassantSquareImpl(); }
+int ChessBoard::getHalfmoveClock() const { return getHalfmoveClockImpl(); }
+std::uint64_t ChessBoard::getPositionHash() const { return getPositionHashImpl(); }
+BoardGeometry const& ChessBoard::getBoardGeometry() const { return getBoardGeometryImpl(); }
+
+Team ChessBoard::getTeamToMove() const { return getTeamToMoveImpl(); }
+void ChessBoard::setTeamToMove(Team team) { setTeamToMoveImpl(team); }
+
+std::vector<BoardSquare> const& ChessBoard::getPieceSquares(Team team) const { return getPieceSquaresImpl(team); }
+std::vector<BoardSquare> const& ChessBoard::getKingSquares(Team team) const { return getKingSquaresImpl(team); }
 
 Team ChessBoard::getTeamOne() const { return getTeamOneImpl(); }
 Team ChessBoard::getTeamTwo() const { return getTeamTwoImpl(); }
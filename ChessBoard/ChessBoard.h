@@ -3,17 +3,24 @@
 #ifndef ChessBoard_h
 #define ChessBoard_h
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <vector>
 
+#include "BoardGeometry.h"
 #include "BoardSquare.h"
 #include "Constants.h"
+#include "LegalMoveCache.h"
+#include "MoveCode.h"
 #include "PieceData.h"
 #include "PieceInfo.h"
+#include "PositionStatus.h"
 
 // Foward declaration to avoid circular dependency among abstract classes
 class BoardMove;   
+class MoveList;
+struct ClassifiedMove;
 
 
 /**
@@ -73,7 +80,12 @@ public:
     };
 
 private:
+    mutable LegalMoveCache legalMoveCache;         // Shared by the game layer queries, a copy of the ChessBoard starts with an empty one
+
+    LegalMoveCache::Entry const& findOrGenerateLegalMoves(Team team) const;
+
     virtual std::unique_ptr<ChessBoard> cloneImpl() const = 0;
+    virtual std::unique_ptr<ChessBoard> clonePositionImpl() const = 0;
 
     virtual std::optional<PieceData> getPieceDataAtImpl(BoardSquare const &boardSquare) const = 0;
     virtual std::optional<PieceInfo> getPieceInfoAtImpl(BoardSquare const &boardSquare) const = 0;
@@ -88,12 +100,15 @@ private:
     virtual bool isInCheckMateImpl(Team team) const = 0;
     virtual bool isInStaleMateImpl(Team team) const = 0;
 
-    virtual std::vector<std::unique_ptr<BoardMove>> generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare) const = 0;
-    virtual std::vector<std::unique_ptr<BoardMove>> generateAllLegalMovesImpl(Team team) const = 0; 
+    virtual void generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const = 0;
+    virtual void generateAllLegalMovesImpl(Team team, MoveList &moves) const = 0; 
+    virtual void generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const = 0;
+    virtual bool isPseudoLegalMoveLegalImpl(MoveCode moveCode) const = 0;
     virtual std::vector<std::unique_ptr<BoardMove>> generateCheckApplyingMovesImpl(Team team) const = 0;
     virtual std::vector<std::unique_ptr<BoardMove>> generateCapturingMovesImpl(Team team) const = 0;
     virtual std::vector<std::unique_ptr<BoardMove>> generateCaptureAvoidingMovesImpl(Team team) const = 0;
     virtual std::vector<std::unique_ptr<BoardMove>> generateWinningMovesImpl(Team team) const = 0;
+    virtual std::vector<ClassifiedMove> generateClassifiedMovesImpl(Team team) const = 0;
 
     virtual void setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) = 0;
     virtual void clearPositionImpl(BoardSquare const &boardSquare) = 0;
@@ -102,10 +117,20 @@ private:
     virtual std::optional<std::unique_ptr<BoardMove>> createBoardMoveImpl(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType = std::nullopt) const = 0;
     virtual bool isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove) const = 0;        
     virtual void makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) = 0;           
+    virtual void makeMoveImpl(MoveCode moveCode) = 0;
     virtual bool undoMoveImpl() = 0;  
     virtual bool redoMoveImpl() = 0; 
 
-    virtual std::vector<std::unique_ptr<BoardMove>> const& getCompletedMovesImpl() const = 0;
+    virtual std::optional<BoardSquare> getEnPassantSquareImpl() const = 0;
+    virtual int getHalfmoveClockImpl() const = 0;
+    virtual std::uint64_t getPositionHashImpl() const = 0;
+    virtual BoardGeometry const& getBoardGeometryImpl() const = 0;
+
+    virtual Team getTeamToMoveImpl() const = 0;
+    virtual void setTeamToMoveImpl(Team team) = 0;
+
+    virtual std::vector<BoardSquare> const& getPieceSquaresImpl(Team team) const = 0;
+    virtual std::vector<BoardSquare> const& getKingSquaresImpl(Team team) const = 0;
 
     virtual Team getTeamOneImpl() const = 0;
     virtual Team getTeamTwoImpl() const = 0;
@@ -136,9 +161,11 @@ protected:
 
     BoardSquareIterator createBoardSquareIterator(int row, int col, int numRowsOnBoard, int numColsOnBoard) const;
     ReverseBoardSquareIterator createReverseBoardSquareIterator(int row, int col, int numRowsOnBoard, int numColsOnBoard) const;
+    std::vector<std::unique_ptr<BoardMove>> decodeMoves(MoveList const &moves) const;
 
 public:
     std::unique_ptr<ChessBoard> clone() const;
+    std::unique_ptr<ChessBoard> clonePosition() const;      // Copies the position without the move history
     virtual ~ChessBoard() = default;
 
     std::optional<PieceData> getPieceDataAt(BoardSquare const &boardSquare) const;
@@ -153,13 +180,22 @@ public:
     bool isInCheck(Team team) const;
     bool isInCheckMate(Team team) const;
     bool isInStaleMate(Team team) const;
+    PositionStatus getPositionStatus(Team team) const;
 
+    LegalMoveCache const& getLegalMoveCache() const;
+    void setLegalMoveCacheCapacity(int capacity);       // 0 disables the cache
+
+    void generateAllLegalMovesAtSquare(BoardSquare const &boardSquare, MoveList &moves) const;
+    void generateAllLegalMoves(Team team, MoveList &moves) const; 
+    void generateAllPseudoLegalMoves(Team team, MoveList &moves) const;
+    bool isPseudoLegalMoveLegal(MoveCode moveCode) const;
     std::vector<std::unique_ptr<BoardMove>> generateAllLegalMovesAtSquare(BoardSquare const &boardSquare) const;
     std::vector<std::unique_ptr<BoardMove>> generateAllLegalMoves(Team team) const; 
     std::vector<std::unique_ptr<BoardMove>> generateCheckApplyingMoves(Team team) const;
     std::vector<std::unique_ptr<BoardMove>> generateCapturingMoves(Team team) const;
     std::vector<std::unique_ptr<BoardMove>> generateCaptureAvoidingMoves(Team team) const;
     std::vector<std::unique_ptr<BoardMove>> generateWinningMoves(Team team) const;
+    std::vector<ClassifiedMove> generateClassifiedMoves(Team team) const;
 
     void setPosition(BoardSquare const &boardSquare, PieceData const &pieceData);    
     void clearPosition(BoardSquare const &boardSquare);
@@ -168,10 +204,20 @@ public:
     std::optional<std::unique_ptr<BoardMove>> createBoardMove(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType = std::nullopt) const;
     bool isMoveLegal(std::unique_ptr<BoardMove> const &boardMove) const;
     void makeMove(std::unique_ptr<BoardMove> const &boardMove);
+    void makeMove(MoveCode moveCode);
     bool undoMove();  
     bool redoMove(); 
 
-    std::vector<std::unique_ptr<BoardMove>> const& getCompletedMoves() const;
+    std::optional<BoardSquare> getEnPassantSquare() const;
+    int getHalfmoveClock() const;
+    std::uint64_t getPositionHash() const;
+    BoardGeometry const& getBoardGeometry() const;
+
+    Team getTeamToMove() const;
+    void setTeamToMove(Team team);
+
+    std::vector<BoardSquare> const& getPieceSquares(Team team) const;
+    std::vector<BoardSquare> const& getKingSquares(Team team) const;
 
     Team getTeamOne() const;
     Team getTeamTwo() const;
@@ -2,17 +2,116 @@
 
 #include "ChessBoardFactory.h"
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
 
+#include "AdaptiveChessBoardImpl.h"
+#include "BitboardChessBoardImpl.h"
+#include "BitboardGeometry.h"
+#include "BoardGeometry.h"
 #include "ChessBoard.h"
 #include "ChessBoardImpl.h"
+#include "Constants.h"
+#include "MagicAttackTables.h"
+#include "StandardChessBoardImpl.h"
+#include "ZobristKeys.h"
 
 
 /*
  * Static
  *
- * Returns a ChessBoard instance
+ * Returns the ZobristKeys for ChessBoards of the size given by the arguments
+ * Keys are built once per board size and shared by every ChessBoard of that size
  */
-std::unique_ptr<ChessBoard> ChessBoardFactory::createChessBoard(int numRowsOnBoard, int numColsOnBoard) {
-    return std::make_unique<ChessBoardImpl>(numRowsOnBoard, numColsOnBoard);
+std::shared_ptr<ZobristKeys const> ChessBoardFactory::getZobristKeys(int numRowsOnBoard, int numColsOnBoard) {
+    static std::map<std::pair<int, int>, std::shared_ptr<ZobristKeys const>> zobristKeysBySize;
+    static std::mutex zobristKeysMutex;
+
+    std::lock_guard<std::mutex> lock(zobristKeysMutex);
+    std::shared_ptr<ZobristKeys const> &zobristKeys = zobristKeysBySize[std::make_pair(numRowsOnBoard, numColsOnBoard)];
+    if (!zobristKeys) {
+        zobristKeys = std::make_shared<ZobristKeys const>(numRowsOnBoard, numColsOnBoard);
+    }
+    return zobristKeys;
+}
+
+/*
+ * Static
+ *
+ * Returns the BoardGeometry for ChessBoards of the size given by the arguments
+ * Tables are built once per board size and shared by every ChessBoard of that size
+ */
+std::shared_ptr<BoardGeometry const> ChessBoardFactory::getBoardGeometry(int numRowsOnBoard, int numColsOnBoard) {
+    static std::map<std::pair<int, int>, std::shared_ptr<BoardGeometry const>> boardGeometriesBySize;
+    static std::mutex boardGeometriesMutex;
+
+    std::lock_guard<std::mutex> lock(boardGeometriesMutex);
+    std::shared_ptr<BoardGeometry const> &boardGeometry = boardGeometriesBySize[std::make_pair(numRowsOnBoard, numColsOnBoard)];
+    if (!boardGeometry) {
+        boardGeometry = std::make_shared<BoardGeometry const>(numRowsOnBoard, numColsOnBoard);
+    }
+    return boardGeometry;
+}
+
+/*
+ * Static
+ *
+ * Returns the BitboardGeometry for ChessBoards of the size given by the arguments
+ * Built once per board size from the shared BoardGeometry, and shared by every BitboardChessBoardImpl of that size
+ */
+std::shared_ptr<BitboardGeometry const> ChessBoardFactory::getBitboardGeometry(int numRowsOnBoard, int numColsOnBoard) {
+    static std::map<std::pair<int, int>, std::shared_ptr<BitboardGeometry const>> bitboardGeometriesBySize;
+    static std::mutex bitboardGeometriesMutex;
+
+    std::shared_ptr<BoardGeometry const> boardGeometry = getBoardGeometry(numRowsOnBoard, numColsOnBoard);
+    std::lock_guard<std::mutex> lock(bitboardGeometriesMutex);
+    std::shared_ptr<BitboardGeometry const> &bitboardGeometry = bitboardGeometriesBySize[std::make_pair(numRowsOnBoard, numColsOnBoard)];
+    if (!bitboardGeometry) {
+        bitboardGeometry = std::make_shared<BitboardGeometry const>(*boardGeometry);
+    }
+    return bitboardGeometry;
+}
+
+/*
+ * Static
+ *
+ * Returns the MagicAttackTables shared by every StandardChessBoardImpl
+ * Built on first use, since searching for the magic numbers takes tens of milliseconds
+ */
+std::shared_ptr<MagicAttackTables const> ChessBoardFactory::getMagicAttackTables() {
+    static std::shared_ptr<MagicAttackTables const> magicAttackTables;
+    static std::mutex magicAttackTablesMutex;
+
+    std::lock_guard<std::mutex> lock(magicAttackTablesMutex);
+    if (!magicAttackTables) {
+        magicAttackTables = std::make_shared<MagicAttackTables const>();
+    }
+    return magicAttackTables;
+}
+
+/*
+ * Static
+ *
+ * Returns a ChessBoard instance that stores its position as given by the ChessBoardBackend argument
+ * AUTO gives an 8x8 ChessBoard that uses a StandardChessBoardImpl until a non standard Piece is placed, and a ChessBoardImpl for any other size
+ */
+std::unique_ptr<ChessBoard> ChessBoardFactory::createChessBoard(int numRowsOnBoard, int numColsOnBoard, ChessBoardBackend chessBoardBackend) {
+    switch (chessBoardBackend) {
+        case ChessBoardBackend::BITBOARD:
+            return std::make_unique<BitboardChessBoardImpl>(numRowsOnBoard, numColsOnBoard, getZobristKeys(numRowsOnBoard, numColsOnBoard),
+                                                            getBoardGeometry(numRowsOnBoard, numColsOnBoard), getBitboardGeometry(numRowsOnBoard, numColsOnBoard));
+        case ChessBoardBackend::AUTO:
+            if (numRowsOnBoard == 8 && numColsOnBoard == 8) {
+                std::shared_ptr<ZobristKeys const> zobristKeys = getZobristKeys(numRowsOnBoard, numColsOnBoard);
+                std::shared_ptr<BoardGeometry const> boardGeometry = getBoardGeometry(numRowsOnBoard, numColsOnBoard);
+                return std::make_unique<AdaptiveChessBoardImpl>(std::make_unique<StandardChessBoardImpl>(zobristKeys, boardGeometry, getMagicAttackTables()),
+                                                                zobristKeys, boardGeometry);
+            }
+            return std::make_unique<ChessBoardImpl>(numRowsOnBoard, numColsOnBoard, getZobristKeys(numRowsOnBoard, numColsOnBoard), getBoardGeometry(numRowsOnBoard, numColsOnBoard));
+        case ChessBoardBackend::MAILBOX:
+        default:
+            return std::make_unique<ChessBoardImpl>(numRowsOnBoard, numColsOnBoard, getZobristKeys(numRowsOnBoard, numColsOnBoard), getBoardGeometry(numRowsOnBoard, numColsOnBoard));
+    }
 }
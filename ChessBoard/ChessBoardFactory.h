@@ -5,15 +5,26 @@
 
 #include <memory>
 
+#include "BitboardGeometry.h"
+#include "BoardGeometry.h"
 #include "ChessBoard.h"
+#include "Constants.h"
+#include "MagicAttackTables.h"
+#include "ZobristKeys.h"
 
 
 /**
  * Factory for creating ChessBoard instances
  */
 class ChessBoardFactory final {
+private:
+    static std::shared_ptr<ZobristKeys const> getZobristKeys(int numRowsOnBoard, int numColsOnBoard);
+    static std::shared_ptr<BoardGeometry const> getBoardGeometry(int numRowsOnBoard, int numColsOnBoard);
+    static std::shared_ptr<BitboardGeometry const> getBitboardGeometry(int numRowsOnBoard, int numColsOnBoard);
+    static std::shared_ptr<MagicAttackTables const> getMagicAttackTables();
+
 public:
-    static std::unique_ptr<ChessBoard> createChessBoard(int numRowsOnBoard, int numColsOnBoard);  
+    static std::unique_ptr<ChessBoard> createChessBoard(int numRowsOnBoard, int numColsOnBoard, ChessBoardBackend chessBoardBackend = ChessBoardBackend::AUTO);
 };
 
 
@@ -3,20 +3,138 @@
 #include "ChessBoardImpl.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
 
+#include "BoardGeometry.h"
 #include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
+#include "ClassifiedMove.h"
 #include "Cloneable.h"
 #include "Constants.h"
+#include "MoveCode.h"
+#include "MoveDirection.h"
+#include "MoveList.h"
+#include "MovePicker.h"
 #include "Piece.h"
+#include "PieceCode.h"
 #include "PieceData.h"
 #include "PieceFactory.h"
 #include "PieceInfo.h"
+#include "PieceMoveGenerator.h"
+#include "PositionState.h"
+#include "StaticChessBoard.h"
+#include "ZobristKeys.h"
+
+
+#pragma mark - Attack Lookup Tables
+
+/*
+ * Static
+ *
+ * Offsets from an attacked square to the squares a Pawn of each PieceDirection would attack it from
+ */
+std::vector<std::pair<PieceDirection, MoveDirection>> const ChessBoardImpl::pawnAttackOrigins = {
+    { PieceDirection::NORTH, MoveDirection(1, -1) },
+    { PieceDirection::NORTH, MoveDirection(1, 1) },
+    { PieceDirection::SOUTH, MoveDirection(-1, -1) },
+    { PieceDirection::SOUTH, MoveDirection(-1, 1) },
+    { PieceDirection::EAST, MoveDirection(-1, -1) },
+    { PieceDirection::EAST, MoveDirection(1, -1) },
+    { PieceDirection::WEST, MoveDirection(-1, 1) },
+    { PieceDirection::WEST, MoveDirection(1, 1) }
+};
+
+/*
+ * Static
+ *
+ * Rook rays, and the single steps of a King or AdvancedBishop
+ */
+std::vector<MoveDirection> const ChessBoardImpl::orthogonalDirections = {
+    { MoveDirection(-1, 0) },
+    { MoveDirection(0, -1) },
+    { MoveDirection(0, 1) },
+    { MoveDirection(1, 0) }
+};
+
+/*
+ * Static
+ *
+ * Bishop rays, and the single steps of a King or AdvancedRook
+ */
+std::vector<MoveDirection> const ChessBoardImpl::diagonalDirections = {
+    { MoveDirection(-1, -1) },
+    { MoveDirection(-1, 1) },
+    { MoveDirection(1, -1) },
+    { MoveDirection(1, 1) }
+};
+
+/*
+ * Static
+ *
+ * Jumps of a Knight or AdvancedQueen
+ */
+std::vector<MoveDirection> const ChessBoardImpl::knightOffsets = {
+    { MoveDirection(-1, -2) },
+    { MoveDirection(-1, 2) },
+    { MoveDirection(1, -2) },
+    { MoveDirection(1, 2) },
+    { MoveDirection(-2, -1) },
+    { MoveDirection(-2, 1) },
+    { MoveDirection(2, -1) },
+    { MoveDirection(2, 1) }
+};
+
+/*
+ * Static
+ *
+ * Additional jumps of an AdvancedKnight
+ */
+std::vector<MoveDirection> const ChessBoardImpl::advancedKnightOffsets = {
+    { MoveDirection(-1, -3) },
+    { MoveDirection(-1, 3) },
+    { MoveDirection(1, -3) },
+    { MoveDirection(1, 3) },
+    { MoveDirection(-3, -1) },
+    { MoveDirection(-3, 1) },
+    { MoveDirection(3, -1) },
+    { MoveDirection(3, 1) }
+};
+
+/*
+ * Static
+ *
+ * Additional jumps of an AdvancedKing
+ */
+std::vector<MoveDirection> const ChessBoardImpl::advancedKingOffsets = {
+    { MoveDirection(-2, -2) },
+    { MoveDirection(-2, 2) },
+    { MoveDirection(2, -2) },
+    { MoveDirection(2, 2) }
+};
+
+
+#pragma mark - ScopedBoardMove
+
+/*
+ * Basic ctor
+ * Predicates using the guard are logically const, the ChessBoardImpl is restored before the guard is destroyed
+ */
+ChessBoardImpl::ScopedBoardMove::ScopedBoardMove(ChessBoardImpl const &chessBoard, MoveCode moveCode) :
+    chessBoard(const_cast<ChessBoardImpl&>(chessBoard)), undoRecord(this->chessBoard.applyMove(moveCode)) { }
+
+/*
+ * Dtor
+ */
+ChessBoardImpl::ScopedBoardMove::~ScopedBoardMove() {
+    chessBoard.revertMove(undoRecord);
+}
 
 
 #pragma mark - Specific To ChessBoardImpl
@@ -24,36 +142,32 @@
 /*
  * Basic ctor
  */
-ChessBoardImpl::ChessBoardImpl(int numRows, int numCols) : Cloneable<ChessBoard, ChessBoardImpl>() {
-    grid.resize(numRows);
-    for (int row = 0; row < numRows; ++row) {
-        grid[row].resize(numCols);
-    } 
+ChessBoardImpl::ChessBoardImpl(int numRows, int numCols, std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry) : Cloneable<ChessBoard, ChessBoardImpl>(),
+    numRowsOnBoard(numRows), numColsOnBoard(numCols), numPaddedRows(numRows + 2 * boardPadding), numPaddedCols(numCols + 2 * boardPadding), 
+    grid(numPaddedRows * numPaddedCols, OFF_BOARD_PIECE_CODE), pieceSquareIndices(numPaddedRows * numPaddedCols, -1), positionState(std::nullopt, teamOne, 0), zobristKeys(std::move(zobristKeys)), boardGeometry(std::move(boardGeometry)), positionHash(0) {
+
+    for (ChessBoard::BoardSquareIterator it = this->begin(); it != this->end(); ++it) {
+        grid[getGridIndex(*it)] = EMPTY_PIECE_CODE;
+    }
 }
 
 /*
  * Copy ctor
  */
-ChessBoardImpl::ChessBoardImpl(ChessBoardImpl const &other) : Cloneable<ChessBoard, ChessBoardImpl>(other) {
-    // Copy grid
-    grid.resize(other.getNumRowsOnBoard());
-    for (int row = 0; row < other.getNumRowsOnBoard(); ++row) {
-        grid[row].resize(other.getNumColsOnBoard());
-        for (int col = 0; col < other.getNumColsOnBoard(); ++col) {
-            if (other.grid[row][col] != nullptr) {
-                grid[row][col] = other.grid[row][col]->clone();
-            }
-        }
-    } 
-    
-    // Copy completed moves
-    for (std::unique_ptr<BoardMove> const &completedMove : other.completedMoves) {
-        completedMoves.emplace_back(completedMove->clone());
-    }
+ChessBoardImpl::ChessBoardImpl(ChessBoardImpl const &other) : 
+    ChessBoardImpl(other, true) { }
 
-    // Copy redo moves
-    for (std::unique_ptr<BoardMove> const &redoMove : other.redoMoves) {
-        redoMoves.emplace_back(redoMove->clone());
+/*
+ * Copy ctor
+ * Copies the move history only if shouldCopyMoveHistory, otherwise the copy starts with nothing to undo or redo
+ */
+ChessBoardImpl::ChessBoardImpl(ChessBoardImpl const &other, bool shouldCopyMoveHistory) : Cloneable<ChessBoard, ChessBoardImpl>(other),
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard), numPaddedRows(other.numPaddedRows), numPaddedCols(other.numPaddedCols), 
+    grid(other.grid), pieceSquares(other.pieceSquares), kingSquares(other.kingSquares), pieceSquareIndices(other.pieceSquareIndices), positionState(other.positionState), zobristKeys(other.zobristKeys), boardGeometry(other.boardGeometry), positionHash(other.positionHash) {
+    
+    if (shouldCopyMoveHistory) {
+        undoRecords = other.undoRecords;
+        redoMoveCodes = other.redoMoveCodes;
     }
 }
 
@@ -61,7 +175,9 @@ ChessBoardImpl::ChessBoardImpl(ChessBoardImpl const &other) : Cloneable<ChessBoa
  * Move ctor
  */
 ChessBoardImpl::ChessBoardImpl(ChessBoardImpl &&other) noexcept : Cloneable<ChessBoard, ChessBoardImpl>(std::move(other)),
-    grid(std::move(other.grid)), completedMoves(std::move(other.completedMoves)), redoMoves(std::move(other.redoMoves)) { }
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard), numPaddedRows(other.numPaddedRows), numPaddedCols(other.numPaddedCols), 
+    grid(std::move(other.grid)), pieceSquares(std::move(other.pieceSquares)), kingSquares(std::move(other.kingSquares)), pieceSquareIndices(std::move(other.pieceSquareIndices)), 
+    positionState(std::move(other.positionState)), undoRecords(std::move(other.undoRecords)), redoMoveCodes(std::move(other.redoMoveCodes)), zobristKeys(std::move(other.zobristKeys)), boardGeometry(std::move(other.boardGeometry)), positionHash(other.positionHash) { }
 
 /*
  * Copy assignment
@@ -71,25 +187,24 @@ ChessBoardImpl& ChessBoardImpl::operator=(ChessBoardImpl const &other) {
         ChessBoard::operator=(other);
 
         // Copy grid
-        grid.resize(other.getNumRowsOnBoard());
-        for (int row = 0; row < other.getNumRowsOnBoard(); ++row) {
-            grid[row].resize(other.getNumColsOnBoard());
-            for (int col = 0; col < other.getNumColsOnBoard(); ++col) {
-                if (other.grid[row][col] != nullptr) {
-                    grid[row][col] = other.grid[row][col]->clone();
-                }
-            }
-        }
-        
-        // Copy completed moves
-        for (std::unique_ptr<BoardMove> const &completedMove : other.completedMoves) {
-            completedMoves.emplace_back(completedMove->clone());
-        }
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        numPaddedRows = other.numPaddedRows;
+        numPaddedCols = other.numPaddedCols;
+        grid = other.grid;
+        pieceSquares = other.pieceSquares;
+        kingSquares = other.kingSquares;
+        pieceSquareIndices = other.pieceSquareIndices;
+        positionState = other.positionState;
 
-        // Copy redo moves
-        for (std::unique_ptr<BoardMove> const &redoMove : other.redoMoves) {
-            redoMoves.emplace_back(redoMove->clone());
-        }
+        // Copy move history
+        undoRecords = other.undoRecords;
+        redoMoveCodes = other.redoMoveCodes;
+
+        zobristKeys = other.zobristKeys;
+        boardGeometry = other.boardGeometry;
+        positionHash = other.positionHash;
+        isCheckInfoValid = { false, false };
     }
     return *this;
 }
@@ -101,13 +216,147 @@ ChessBoardImpl& ChessBoardImpl::operator=(ChessBoardImpl &&other) noexcept {
     if (this != &other) {
         ChessBoard::operator=(std::move(other));
 
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        numPaddedRows = other.numPaddedRows;
+        numPaddedCols = other.numPaddedCols;
         grid = std::move(other.grid);
-        completedMoves = std::move(other.completedMoves);
-        redoMoves = std::move(other.redoMoves);
+        pieceSquares = std::move(other.pieceSquares);
+        kingSquares = std::move(other.kingSquares);
+        pieceSquareIndices = std::move(other.pieceSquareIndices);
+        positionState = std::move(other.positionState);
+        undoRecords = std::move(other.undoRecords);
+        redoMoveCodes = std::move(other.redoMoveCodes);
+        zobristKeys = std::move(other.zobristKeys);
+        boardGeometry = std::move(other.boardGeometry);
+        positionHash = other.positionHash;
+        isCheckInfoValid = { false, false };
     }
     return *this;
 }
 
+/*
+ * Returns the index into the grid of the BoardSquare argument
+ * BoardSquare argument must be within the padded grid
+ */
+int ChessBoardImpl::getGridIndex(BoardSquare const &boardSquare) const {
+    return (boardSquare.boardRow + boardPadding) * numPaddedCols + boardSquare.boardCol + boardPadding;
+}
+
+/*
+ * Returns the distance between two grid indices that are separated by the MoveDirection argument
+ */
+int ChessBoardImpl::getGridOffset(MoveDirection const &moveDirection) const {
+    return moveDirection.rowDirection * numPaddedCols + moveDirection.colDirection;
+}
+
+/*
+ * Returns the BoardSquare at the grid index argument
+ */
+BoardSquare ChessBoardImpl::getBoardSquare(int gridIndex) const {
+    return BoardSquare(gridIndex / numPaddedCols - boardPadding, gridIndex % numPaddedCols - boardPadding);
+}
+
+/*
+ * Static
+ *
+ * Returns how many steps of the MoveDirection argument lead from the origin BoardSquare argument to the BoardSquare argument
+ * - 0 if the BoardSquare argument is not strictly ahead of the origin along the MoveDirection argument
+ */
+int ChessBoardImpl::getRayDistance(BoardSquare const &originSquare, MoveDirection const &moveDirection, BoardSquare const &boardSquare) {
+    int rowDelta = boardSquare.boardRow - originSquare.boardRow;
+    int colDelta = boardSquare.boardCol - originSquare.boardCol;
+    int distance = moveDirection.rowDirection != 0
+        ? rowDelta / moveDirection.rowDirection
+        : colDelta / moveDirection.colDirection;
+    return distance > 0 && rowDelta == distance * moveDirection.rowDirection && colDelta == distance * moveDirection.colDirection
+        ? distance
+        : 0;
+}
+
+/*
+ * Returns the PieceCode at the BoardSquare argument
+ * - OFF_BOARD_PIECE_CODE if BoardSquare argument is not on the ChessBoard
+ */
+PieceCode ChessBoardImpl::getPieceCodeAt(BoardSquare const &boardSquare) const {
+    unsigned int paddedRow = boardSquare.boardRow + boardPadding;
+    unsigned int paddedCol = boardSquare.boardCol + boardPadding;
+    return paddedRow < static_cast<unsigned int>(numPaddedRows) && paddedCol < static_cast<unsigned int>(numPaddedCols)
+        ? grid[paddedRow * numPaddedCols + paddedCol]
+        : OFF_BOARD_PIECE_CODE;
+}
+
+/*
+ * Returns the index of the Team argument into the per Team piece lists
+ */
+int ChessBoardImpl::getTeamIndex(Team team) const {
+    return team == teamOne
+        ? 0
+        : 1;
+}
+
+/*
+ * Record a Piece with the PieceCode argument at the BoardSquare argument in the piece lists
+ */
+void ChessBoardImpl::addToPieceSquares(BoardSquare const &boardSquare, PieceCode pieceCode) {
+    int teamIndex = getTeamIndex(PieceCodeUtilities::getTeam(pieceCode));
+    pieceSquareIndices[getGridIndex(boardSquare)] = pieceSquares[teamIndex].size();
+    pieceSquares[teamIndex].emplace_back(boardSquare);
+    if (PieceCodeUtilities::getPieceType(pieceCode) == PieceType::KING) {
+        kingSquares[teamIndex].emplace_back(boardSquare);
+    }
+}
+
+/*
+ * Remove the Piece with the PieceCode argument at the BoardSquare argument from the piece lists
+ * Swaps the last entry into the vacated slot, so removal is constant time
+ */
+void ChessBoardImpl::removeFromPieceSquares(BoardSquare const &boardSquare, PieceCode pieceCode) {
+    int teamIndex = getTeamIndex(PieceCodeUtilities::getTeam(pieceCode));
+    std::vector<BoardSquare> &teamPieceSquares = pieceSquares[teamIndex];
+    int &pieceSquareIndex = pieceSquareIndices[getGridIndex(boardSquare)];
+
+    BoardSquare const &lastPieceSquare = teamPieceSquares.back();
+    pieceSquareIndices[getGridIndex(lastPieceSquare)] = pieceSquareIndex;
+    teamPieceSquares[pieceSquareIndex] = lastPieceSquare;
+    teamPieceSquares.pop_back();
+    pieceSquareIndex = -1;
+
+    if (PieceCodeUtilities::getPieceType(pieceCode) == PieceType::KING) {
+        std::vector<BoardSquare> &teamKingSquares = kingSquares[teamIndex];
+        teamKingSquares.erase(std::find(teamKingSquares.begin(), teamKingSquares.end(), boardSquare));
+    }
+}
+
+/*
+ * Write the PieceCode argument to the square at the grid index argument, keeping the piece lists and position hash in sync
+ */
+void ChessBoardImpl::setPieceCodeAt(int gridIndex, PieceCode newPieceCode) {
+    PieceCode &pieceCode = grid[gridIndex];
+    BoardSquare boardSquare = getBoardSquare(gridIndex);
+    positionHash ^= 
+        zobristKeys->getPieceKey(boardSquare.boardRow, boardSquare.boardCol, pieceCode) ^ 
+        zobristKeys->getPieceKey(boardSquare.boardRow, boardSquare.boardCol, newPieceCode);
+
+    // Piece lists only change if the square changes owner or gains / loses a King
+    bool isPiece = PieceCodeUtilities::isPiece(pieceCode);
+    bool isNewPiece = PieceCodeUtilities::isPiece(newPieceCode);
+    bool isListEntryUnchanged = 
+        isPiece && isNewPiece &&
+        PieceCodeUtilities::getTeam(pieceCode) == PieceCodeUtilities::getTeam(newPieceCode) && 
+        (PieceCodeUtilities::getPieceType(pieceCode) == PieceType::KING) == (PieceCodeUtilities::getPieceType(newPieceCode) == PieceType::KING);
+    if (!isListEntryUnchanged) {
+        if (isPiece) {
+            removeFromPieceSquares(boardSquare, pieceCode);
+        }
+        if (isNewPiece) {
+            addToPieceSquares(boardSquare, newPieceCode);
+        }
+    }
+    pieceCode = newPieceCode;
+    isCheckInfoValid = { false, false };
+}
+
 /*
  * Returns team opposite to team argument
  */
@@ -118,48 +367,345 @@ Team ChessBoardImpl::getOtherTeam(Team team) const {
 }
 
 /*
- * Generates all pseudo legal moves originating from the BoardSquare argument
+ * Set the square of the Piece that can currently be captured en passant, keeping the position hash in sync
  */
-std::vector<std::unique_ptr<BoardMove>> ChessBoardImpl::generateAllPseudoLegalMovesAtSquare(BoardSquare const &boardSquare, bool onlyAttackingMoves) const {
-    if (isSquareOnBoard(boardSquare) && !isSquareEmpty(boardSquare)) {
-        std::unique_ptr<ChessBoard> tempBoard(this->clone());
-        return grid[boardSquare.boardRow][boardSquare.boardCol]->getMoves(tempBoard, boardSquare, onlyAttackingMoves);
-    } else {
-        return std::vector<std::unique_ptr<BoardMove>>();
+void ChessBoardImpl::setEnPassantSquare(std::optional<BoardSquare> const &newEnPassantSquare) {
+    std::optional<BoardSquare> &enPassantSquare = positionState.enPassantSquare;
+    if (enPassantSquare.has_value()) {
+        positionHash ^= zobristKeys->getEnPassantKey(enPassantSquare.value().boardRow, enPassantSquare.value().boardCol);
+    }
+    if (newEnPassantSquare.has_value()) {
+        positionHash ^= zobristKeys->getEnPassantKey(newEnPassantSquare.value().boardRow, newEnPassantSquare.value().boardCol);
     }
+    enPassantSquare = newEnPassantSquare;
 }
 
 /*
- * Generate all pseudo legal moves that can be made by the Team argument
+ * Apply the move represented by the MoveCode argument by writing its squares directly, and advance the PositionState past it
+ * Returns the UndoRecord that reverts it, without touching the undo and redo stacks
+ */
+ChessBoardImpl::UndoRecord ChessBoardImpl::applyMove(MoveCode moveCode) {
+    BoardSquare toSquare = MoveCodeUtilities::getToSquare(moveCode, numColsOnBoard);
+    int fromGridIndex = getGridIndex(MoveCodeUtilities::getFromSquare(moveCode, numColsOnBoard));
+    int toGridIndex = getGridIndex(toSquare);
+    int captureGridIndex = getGridIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard));
+    std::optional<BoardSquare> const &enPassantSquare = positionState.enPassantSquare;
+
+    UndoRecord undoRecord = {
+        moveCode, grid[fromGridIndex], grid[captureGridIndex], grid[toGridIndex], EMPTY_PIECE_CODE,
+        enPassantSquare.has_value() ? getGridIndex(enPassantSquare.value()) : -1, positionState.teamToMove, positionState.halfmoveClock, positionHash
+    };
+
+    // Move the Piece, promoting it if needed
+    PieceCode movedPieceCode = PieceCodeUtilities::withHasMoved(undoRecord.movedPieceCode, true);
+    if (MoveCodeUtilities::isPromotion(moveCode)) {
+        movedPieceCode = PieceCodeUtilities::withPieceType(movedPieceCode, MoveCodeUtilities::getPromotionPieceType(moveCode).value());
+    }
+    setPieceCodeAt(captureGridIndex, EMPTY_PIECE_CODE);
+    setPieceCodeAt(toGridIndex, movedPieceCode);
+    setPieceCodeAt(fromGridIndex, EMPTY_PIECE_CODE);
+
+    // Move the Rook of a castle
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        int rookFromGridIndex = getGridIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard));
+        int rookToGridIndex = getGridIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard));
+        undoRecord.castledRookPieceCode = grid[rookFromGridIndex];
+        setPieceCodeAt(rookToGridIndex, PieceCodeUtilities::withHasMoved(undoRecord.castledRookPieceCode, true));
+        setPieceCodeAt(rookFromGridIndex, EMPTY_PIECE_CODE);
+    }
+
+    // Advance the PositionState
+    bool doesResetHalfmoveClock = 
+        PieceCodeUtilities::getPieceType(undoRecord.movedPieceCode) == PieceType::PAWN || 
+        PieceCodeUtilities::isPiece(undoRecord.capturedPieceCode);
+    setEnPassantSquare(MoveCodeUtilities::getDoesEnableEnpassant(moveCode) ? std::make_optional<BoardSquare>(toSquare) : std::nullopt);
+    setTeamToMove(getOtherTeam(PieceCodeUtilities::getTeam(undoRecord.movedPieceCode)));
+    positionState.halfmoveClock = doesResetHalfmoveClock ? 0 : positionState.halfmoveClock + 1;
+    return undoRecord;
+}
+
+/*
+ * Revert the move recorded by the UndoRecord argument, which must be the last move applied
+ * The prior PositionState and position hash are written back directly
+ */
+void ChessBoardImpl::revertMove(UndoRecord const &undoRecord) {
+    MoveCode moveCode = undoRecord.moveCode;
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        setPieceCodeAt(getGridIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard)), EMPTY_PIECE_CODE);
+        setPieceCodeAt(getGridIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard)), undoRecord.castledRookPieceCode);
+    }
+    setPieceCodeAt(getGridIndex(MoveCodeUtilities::getToSquare(moveCode, numColsOnBoard)), undoRecord.replacedPieceCode);
+    setPieceCodeAt(getGridIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard)), undoRecord.capturedPieceCode);
+    setPieceCodeAt(getGridIndex(MoveCodeUtilities::getFromSquare(moveCode, numColsOnBoard)), undoRecord.movedPieceCode);
+
+    positionState.enPassantSquare = undoRecord.enPassantGridIndex >= 0 
+        ? std::make_optional<BoardSquare>(getBoardSquare(undoRecord.enPassantGridIndex)) 
+        : std::nullopt;
+    positionState.teamToMove = undoRecord.teamToMove;
+    positionState.halfmoveClock = undoRecord.halfmoveClock;
+    positionHash = undoRecord.positionHash;
+}
+
+/*
+ * Appends all pseudo legal moves originating from the BoardSquare argument to the MoveList argument
+ * Generated by PieceMoveGenerator instantiated against ChessBoardImpl, rather than through the Piece, so square probes are not virtual
+ */
+void ChessBoardImpl::generateAllPseudoLegalMovesAtSquare(BoardSquare const &boardSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    if (PieceCodeUtilities::isPiece(pieceCode)) {
+        PieceMoveGenerator<ChessBoardImpl>::addMoves(*this, PieceCodeUtilities::decode(pieceCode), boardSquare, onlyAttackingMoves, moves);
+    }
+}
+
+/*
+ * Appends all pseudo legal moves that can be made by the Team argument to the MoveList argument
  * onlyAttackingMoves: if true, do not generate any moves that are non-capturing moves (castling)
  */
-std::vector<std::unique_ptr<BoardMove>> ChessBoardImpl::generateAllPseudoLegalMoves(Team team, bool onlyAttackingMoves) const {
-    std::vector<std::unique_ptr<BoardMove>> boardMoves;
-    for (ChessBoard::BoardSquareIterator it = this->begin(); it != this->end(); ++it) {
-        std::optional<PieceData> pieceData = getPieceDataAt(*it);
-        if (pieceData.has_value() && pieceData.value().team == team) {
-            std::vector<std::unique_ptr<BoardMove>> pieceBoardMoves = generateAllPseudoLegalMovesAtSquare(*it, onlyAttackingMoves);
-            for (std::unique_ptr<BoardMove> &pieceBoardMove : pieceBoardMoves) {
-                boardMoves.emplace_back(std::move(pieceBoardMove));
+void ChessBoardImpl::generateAllPseudoLegalMoves(Team team, bool onlyAttackingMoves, MoveList &moves) const {
+    for (BoardSquare const &pieceSquare : getPieceSquares(team)) {
+        generateAllPseudoLegalMovesAtSquare(pieceSquare, onlyAttackingMoves, moves);
+    }
+}
+
+/*
+ * Finds the Pieces of the attacking Team argument that attack the grid index argument, stopping once maxAttackers (at most 2) have been found
+ * Works outward from the grid index argument, looking for an attacker at every offset a Piece could attack it from
+ * The ignored grid index argument is treated as empty, so that a King can be lifted off the board when testing its destination
+ * Returns the number of attackers found, their grid indices are written to the attackerGridIndices argument
+ */
+int ChessBoardImpl::findAttackers(int gridIndex, Team attackingTeam, int ignoredGridIndex, int maxAttackers, std::array<int, 2> &attackerGridIndices) const {
+    int numAttackers = 0;
+    auto isSearchComplete = [&numAttackers, &attackerGridIndices, maxAttackers](int attackerGridIndex) {
+        attackerGridIndices[numAttackers++] = attackerGridIndex;
+        return numAttackers == maxAttackers;
+    };
+
+    // Pawns
+    for (std::pair<PieceDirection, MoveDirection> const &pawnAttackOrigin : pawnAttackOrigins) {
+        int attackerIndex = gridIndex + getGridOffset(pawnAttackOrigin.second);
+        PieceCode pieceCode = grid[attackerIndex];
+        if (PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::PAWN) && PieceCodeUtilities::getPieceDirection(pieceCode) == pawnAttackOrigin.first && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+    }
+
+    // Knights, AdvancedQueens
+    for (MoveDirection const &knightOffset : knightOffsets) {
+        int attackerIndex = gridIndex + getGridOffset(knightOffset);
+        PieceCode pieceCode = grid[attackerIndex];
+        if ((PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::KNIGHT) || 
+             PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::QUEEN, PieceLevel::ADVANCED)) && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+    }
+
+    // AdvancedKnights
+    for (MoveDirection const &advancedKnightOffset : advancedKnightOffsets) {
+        int attackerIndex = gridIndex + getGridOffset(advancedKnightOffset);
+        if (PieceCodeUtilities::isPieceOf(grid[attackerIndex], attackingTeam, PieceType::KNIGHT, PieceLevel::ADVANCED) && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+    }
+
+    // AdvancedKings
+    for (MoveDirection const &advancedKingOffset : advancedKingOffsets) {
+        int attackerIndex = gridIndex + getGridOffset(advancedKingOffset);
+        if (PieceCodeUtilities::isPieceOf(grid[attackerIndex], attackingTeam, PieceType::KING, PieceLevel::ADVANCED) && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+    }
+
+    // Orthogonal steps (Kings, AdvancedBishops) and rays (Rooks, Queens)
+    for (MoveDirection const &orthogonalDirection : orthogonalDirections) {
+        int gridOffset = getGridOffset(orthogonalDirection);
+        int attackerIndex = gridIndex + gridOffset;
+        PieceCode pieceCode = grid[attackerIndex];
+        if ((PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::KING) || 
+             PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::BISHOP, PieceLevel::ADVANCED)) && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+        while (pieceCode == EMPTY_PIECE_CODE || attackerIndex == ignoredGridIndex) {
+            attackerIndex += gridOffset;
+            pieceCode = grid[attackerIndex];
+        }
+        if ((PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::ROOK) || 
+             PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::QUEEN)) && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+    }
+
+    // Diagonal steps (Kings, AdvancedRooks) and rays (Bishops, Queens)
+    for (MoveDirection const &diagonalDirection : diagonalDirections) {
+        int gridOffset = getGridOffset(diagonalDirection);
+        int attackerIndex = gridIndex + gridOffset;
+        PieceCode pieceCode = grid[attackerIndex];
+        if ((PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::KING) || 
+             PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::ROOK, PieceLevel::ADVANCED)) && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+        while (pieceCode == EMPTY_PIECE_CODE || attackerIndex == ignoredGridIndex) {
+            attackerIndex += gridOffset;
+            pieceCode = grid[attackerIndex];
+        }
+        if ((PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::BISHOP) || 
+             PieceCodeUtilities::isPieceOf(pieceCode, attackingTeam, PieceType::QUEEN)) && isSearchComplete(attackerIndex)) {
+            return numAttackers;
+        }
+    }
+
+    return numAttackers;
+}
+
+/*
+ * Walks the ray directions argument outward from the King recorded in the CheckInfo argument
+ * - Records a pin when the first Piece on a ray belongs to the Team argument and the next is an opposing slider (sliderType or Queen)
+ * - Records the direction of the checker when the first Piece on a ray is the single checking slider
+ */
+void ChessBoardImpl::findPinsAndSlidingChecker(CheckInfo &checkInfo, Team team, std::vector<MoveDirection> const &rayDirections, PieceType sliderType) const {
+    Team otherTeam = getOtherTeam(team);
+    int kingIndex = getGridIndex(checkInfo.kingSquare.value());
+
+    for (MoveDirection const &rayDirection : rayDirections) {
+        int gridOffset = getGridOffset(rayDirection);
+        int firstIndex = kingIndex + gridOffset;
+        while (grid[firstIndex] == EMPTY_PIECE_CODE) {
+            firstIndex += gridOffset;
+        }
+
+        PieceCode firstPieceCode = grid[firstIndex];
+        if (PieceCodeUtilities::isPiece(firstPieceCode) && PieceCodeUtilities::getTeam(firstPieceCode) == team) {
+            int secondIndex = firstIndex + gridOffset;
+            while (grid[secondIndex] == EMPTY_PIECE_CODE) {
+                secondIndex += gridOffset;
+            }
+            if (PieceCodeUtilities::isPieceOf(grid[secondIndex], otherTeam, sliderType) || PieceCodeUtilities::isPieceOf(grid[secondIndex], otherTeam, PieceType::QUEEN)) {
+                checkInfo.pins.emplace_back(getBoardSquare(firstIndex), rayDirection);
             }
-            pieceBoardMoves.clear();
+        } else if (checkInfo.numCheckers == 1 && checkInfo.checkerSquare.value() == getBoardSquare(firstIndex) &&
+                   (PieceCodeUtilities::isPieceOf(firstPieceCode, otherTeam, sliderType) || PieceCodeUtilities::isPieceOf(firstPieceCode, otherTeam, PieceType::QUEEN))) {
+            checkInfo.checkerDirection = rayDirection;
+        }
+    }
+}
+
+/*
+ * Returns the checkers and absolute pins against the King of the Team argument
+ * Computed on first use and cached until the Pieces on the ChessBoardImpl change
+ */
+ChessBoardImpl::CheckInfo const& ChessBoardImpl::getCheckInfo(Team team) const {
+    int teamIndex = getTeamIndex(team);
+    CheckInfo &checkInfo = checkInfos[teamIndex];
+    if (isCheckInfoValid[teamIndex]) {
+        return checkInfo;
+    }
+    isCheckInfoValid[teamIndex] = true;
+
+    checkInfo.kingSquare = std::nullopt;
+    checkInfo.numCheckers = 0;
+    checkInfo.checkerSquare = std::nullopt;
+    checkInfo.checkerDirection = std::nullopt;
+    checkInfo.pins.clear();
+
+    std::vector<BoardSquare> const &teamKingSquares = getKingSquares(team);
+    if (teamKingSquares.size() != 1) {
+        return checkInfo;
+    }
+    checkInfo.kingSquare = teamKingSquares.front();
+
+    std::array<int, 2> checkerGridIndices;
+    checkInfo.numCheckers = findAttackers(getGridIndex(teamKingSquares.front()), getOtherTeam(team), -1, 2, checkerGridIndices);
+    if (checkInfo.numCheckers == 1) {
+        checkInfo.checkerSquare = getBoardSquare(checkerGridIndices[0]);
+    }
+
+    findPinsAndSlidingChecker(checkInfo, team, orthogonalDirections, PieceType::ROOK);
+    findPinsAndSlidingChecker(checkInfo, team, diagonalDirections, PieceType::BISHOP);
+    return checkInfo;
+}
+
+/*
+ * True if the pseudo legal BoardMove argument does not leave its own King attacked, false otherwise
+ * - King moves test the destination with the King lifted off the board, castles and en passant captures are made and unmade
+ * - Other moves are checked against the checkers and pins in the CheckInfo argument
+ * - Falls back to making and unmaking the move if the Team does not have exactly one King
+ */
+bool ChessBoardImpl::isPseudoLegalMoveLegal(MoveCode moveCode, CheckInfo const &checkInfo) const {
+    if (!checkInfo.kingSquare.has_value()) {
+        return !doesMoveLeaveTeamInCheck(moveCode);
+    }
+
+    BoardSquare const &kingSquare = checkInfo.kingSquare.value();
+    BoardSquare fromSquare = MoveCodeUtilities::getFromSquare(moveCode, numColsOnBoard);
+    BoardSquare toSquare = MoveCodeUtilities::getToSquare(moveCode, numColsOnBoard);
+    MoveKind moveKind = MoveCodeUtilities::getMoveKind(moveCode);
+
+    // King moves
+    if (fromSquare == kingSquare) {
+        if (moveKind == MoveKind::CASTLE) {
+            return !doesMoveLeaveTeamInCheck(moveCode);
         }
+
+        std::array<int, 2> attackerGridIndices;
+        Team otherTeam = getOtherTeam(PieceCodeUtilities::getTeam(getPieceCodeAt(fromSquare)));
+        return findAttackers(getGridIndex(toSquare), otherTeam, getGridIndex(fromSquare), 1, attackerGridIndices) == 0;
+    }
+
+    // En passant, which can uncover an attack along the row of the captured Piece
+    if (moveKind == MoveKind::EN_PASSANT_SAME_ROW || moveKind == MoveKind::EN_PASSANT_SAME_COL) {
+        return !doesMoveLeaveTeamInCheck(moveCode);
     }
-    return boardMoves;
+
+    // Check evasion: capture or block the single checker
+    if (checkInfo.numCheckers >= 2) {
+        return false;
+    } else if (checkInfo.numCheckers == 1 && toSquare != checkInfo.checkerSquare.value()) {
+        if (!checkInfo.checkerDirection.has_value()) {
+            return false;
+        }
+        int blockDistance = getRayDistance(kingSquare, checkInfo.checkerDirection.value(), toSquare);
+        int checkerDistance = getRayDistance(kingSquare, checkInfo.checkerDirection.value(), checkInfo.checkerSquare.value());
+        if (blockDistance == 0 || blockDistance >= checkerDistance) {
+            return false;
+        }
+    }
+
+    // Pinned Pieces stay on the line between the King and the pinning Piece
+    for (std::pair<BoardSquare, MoveDirection> const &pin : checkInfo.pins) {
+        if (pin.first == fromSquare) {
+            return getRayDistance(kingSquare, pin.second, toSquare) > 0;
+        }
+    }
+    return true;
+}
+
+/*
+ * Removes the illegal moves from the MoveList argument in place, keeping the order of the legal ones
+ * Only moves from firstMoveIndex onward are filtered, and they must all be pseudo legal moves of the Team argument
+ */
+void ChessBoardImpl::filterLegalMoves(MoveList &moves, int firstMoveIndex, Team team) const {
+    CheckInfo const &checkInfo = getCheckInfo(team);
+    int numLegalMoves = firstMoveIndex;
+    for (int moveIndex = firstMoveIndex; moveIndex < moves.size(); ++moveIndex) {
+        if (isPseudoLegalMoveLegal(moves[moveIndex], checkInfo)) {
+            moves[numLegalMoves++] = moves[moveIndex];
+        }
+    }
+    moves.truncate(numLegalMoves);
 }
 
 /*
  * Clears the recorded redo moves
  */
 void ChessBoardImpl::clearRedoMoves() {
-    redoMoves.clear();
+    redoMoveCodes.clear();
 }
 
 /*
  * True if Team argument has a legal move available to make, false otherwise
  */
 bool ChessBoardImpl::canMakeMove(Team team) const {
-    return !generateAllLegalMoves(team).empty();
+    MovePicker movePicker(*this, team);
+    return movePicker.next().has_value();
 }
 
 /*
@@ -167,10 +713,9 @@ bool ChessBoardImpl::canMakeMove(Team team) const {
  */
 bool ChessBoardImpl::doesMoveApplyCheck(std::unique_ptr<BoardMove> const &boardMove) const {
     Team otherTeam = getOtherTeam(getPieceDataAt(boardMove->getFromSquare()).value().team);
-    ChessBoardImpl temp(*this);
-    temp.makeMove(boardMove);
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
 
-    return temp.isInCheck(otherTeam);
+    return isInCheck(otherTeam);
 }
 
 /*
@@ -178,7 +723,7 @@ bool ChessBoardImpl::doesMoveApplyCheck(std::unique_ptr<BoardMove> const &boardM
  */
 bool ChessBoardImpl::doesMoveCapturePiece(std::unique_ptr<BoardMove> const &boardMove) const {
     Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
-    std::optional<PieceData> attackedPieceData = getPieceDataAt(boardMove->getCaptureSquare()).value();
+    std::optional<PieceData> attackedPieceData = getPieceDataAt(boardMove->getCaptureSquare());
     
     return attackedPieceData.has_value() && attackedPieceData.value().team != movedPieceTeam;
 }
@@ -188,10 +733,11 @@ bool ChessBoardImpl::doesMoveCapturePiece(std::unique_ptr<BoardMove> const &boar
  */
 bool ChessBoardImpl::doesMoveLeavePieceAttacked(std::unique_ptr<BoardMove> const &boardMove) const {
     Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
-    ChessBoardImpl temp(*this);
-    temp.makeMove(boardMove);
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
 
-    return temp.generateCapturingMoves(getOtherTeam(movedPieceTeam)).empty();
+    MoveList replyMoves;
+    generateAllLegalMoves(getOtherTeam(movedPieceTeam), replyMoves);
+    return std::any_of(replyMoves.begin(), replyMoves.end(), [](MoveCode replyMove) { return MoveCodeUtilities::isCapture(replyMove); });
 }
 
 /*
@@ -199,10 +745,9 @@ bool ChessBoardImpl::doesMoveLeavePieceAttacked(std::unique_ptr<BoardMove> const
  */
 bool ChessBoardImpl::doesMoveWinGame(std::unique_ptr<BoardMove> const &boardMove) const {
     Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
-    ChessBoardImpl temp(*this);
-    temp.makeMove(boardMove);
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
 
-    return temp.isInCheckMate(getOtherTeam(movedPieceTeam));
+    return isInCheckMate(getOtherTeam(movedPieceTeam));
 }
 
 /*
@@ -210,12 +755,21 @@ bool ChessBoardImpl::doesMoveWinGame(std::unique_ptr<BoardMove> const &boardMove
  */
 bool ChessBoardImpl::doesMoveLeaveTeamInCheck(std::unique_ptr<BoardMove> const &boardMove) const {
     Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
-    ChessBoardImpl temp(*this);
-    temp.makeMove(boardMove);
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
 
-    return temp.isInCheck(movedPieceTeam);
+    return isInCheck(movedPieceTeam);
 } 
 
+/*
+ * True if the move represented by the MoveCode argument would leave it's own team in check after being made, false otherwise
+ */
+bool ChessBoardImpl::doesMoveLeaveTeamInCheck(MoveCode moveCode) const {
+    Team movedPieceTeam = PieceCodeUtilities::getTeam(getPieceCodeAt(MoveCodeUtilities::getFromSquare(moveCode, numColsOnBoard)));
+    ScopedBoardMove scopedBoardMove(*this, moveCode);
+
+    return isInCheck(movedPieceTeam);
+}
+
 
 #pragma mark - ChessBoard Interface Implementation
 
@@ -225,8 +779,9 @@ bool ChessBoardImpl::doesMoveLeaveTeamInCheck(std::unique_ptr<BoardMove> const &
  * - nullopt otherwise
  */
 std::optional<PieceData> ChessBoardImpl::getPieceDataAtImpl(BoardSquare const &boardSquare) const {
-    return isSquareOnBoard(boardSquare) && grid[boardSquare.boardRow][boardSquare.boardCol] != nullptr
-        ? std::make_optional<PieceData>(grid[boardSquare.boardRow][boardSquare.boardCol]->getPieceData())
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode)
+        ? std::make_optional<PieceData>(PieceCodeUtilities::decode(pieceCode))
         : std::nullopt;
 }
 
@@ -236,8 +791,9 @@ std::optional<PieceData> ChessBoardImpl::getPieceDataAtImpl(BoardSquare const &b
  * - nullopt otherwise
  */
 std::optional<PieceInfo> ChessBoardImpl::getPieceInfoAtImpl(BoardSquare const &boardSquare) const {
-    return isSquareOnBoard(boardSquare) && grid[boardSquare.boardRow][boardSquare.boardCol] != nullptr
-        ? std::make_optional<PieceInfo>(grid[boardSquare.boardRow][boardSquare.boardCol]->getPieceInfo())
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode)
+        ? std::make_optional<PieceInfo>(PieceFactory::getPiece(pieceCode).getPieceInfo())
         : std::nullopt;
 }
 
@@ -259,62 +815,42 @@ bool ChessBoardImpl::isSquareOnBoardImpl(BoardSquare const &boardSquare) const {
  * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and there is no Piece at that location, false otherwise
  */
 bool ChessBoardImpl::isSquareEmptyImpl(BoardSquare const &boardSquare) const {
-    return 
-        isSquareOnBoard(boardSquare) && 
-        !getPieceInfoAt(boardSquare).has_value();
+    return getPieceCodeAt(boardSquare) == EMPTY_PIECE_CODE;
 }
 
 /*
  * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and the Team of The Piece at that location is equal to the Team argument, false otherwise
  */
 bool ChessBoardImpl::isSquareSameTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const {
-    if (isSquareOnBoard(boardSquare)) {
-        std::optional<PieceData> pieceDataAtSquare = getPieceDataAt(boardSquare);
-        if (pieceDataAtSquare.has_value() && pieceDataAtSquare.value().team == ownTeam) {
-            return true;
-        }
-    }
-    return false;
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode) && PieceCodeUtilities::getTeam(pieceCode) == ownTeam;
 }
 
 /*
  * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and the Team of The Piece at that location is not equal to the Team argument, false otherwise
  */
 bool ChessBoardImpl::isSquareOtherTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const {
-    if (isSquareOnBoard(boardSquare)) {
-        std::optional<PieceData> pieceDataAtSquare = getPieceDataAt(boardSquare);
-        if (pieceDataAtSquare && pieceDataAtSquare.value().team == getOtherTeam(ownTeam)) {
-            return true;
-        }
-    }
-    return false;
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode) && PieceCodeUtilities::getTeam(pieceCode) == getOtherTeam(ownTeam);
 }
 
 /*
  * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and that location is attacked by the Team opposite to the Team argument, false otherwise
  */
 bool ChessBoardImpl::isSquareAttackedImpl(BoardSquare const &boardSquare, Team ownTeam) const {
-    if (isSquareOnBoard(boardSquare)) {
-        std::vector<std::unique_ptr<BoardMove>> attackingBoardMoves = generateAllPseudoLegalMoves(getOtherTeam(ownTeam), true);
-        for (std::unique_ptr<BoardMove> const& boardMove : attackingBoardMoves) {
-            if (boardMove->getCaptureSquare() == boardSquare) {
-                return true;
-            }
-        }
-    }
-    return false;
+    std::array<int, 2> attackerGridIndices;
+    return 
+        isSquareOnBoard(boardSquare) && 
+        findAttackers(getGridIndex(boardSquare), getOtherTeam(ownTeam), -1, 1, attackerGridIndices) > 0;
 }
 
 /*
  * True if Team argument is in check, false otherwise
  */
 bool ChessBoardImpl::isInCheckImpl(Team team) const {
-    for (ChessBoard::BoardSquareIterator it = this->cbegin(); it != this->cend(); ++it) {
-        std::optional<PieceData> pieceData = getPieceDataAt(*it);
-        if (pieceData.has_value() && pieceData.value().pieceType == PieceType::KING && pieceData.value().team == team) {
-            if (isSquareAttacked(*it, team)) {
-                return true;
-            }
+    for (BoardSquare const &kingSquare : getKingSquares(team)) {
+        if (isSquareAttacked(kingSquare, team)) {
+            return true;
         }
     }
     return false;
@@ -331,35 +867,42 @@ bool ChessBoardImpl::isInCheckMateImpl(Team team) const {
  * True if Team argument is in stalemate, false otherwise
  */
 bool ChessBoardImpl::isInStaleMateImpl(Team team) const {
-    return !canMakeMove(team) && !isInCheck(team);
+    return !isInCheck(team) && !canMakeMove(team);
 }
 
 /*
- * Generate all legal moves originating from the BoardSquare argument
+ * Appends all legal moves originating from the BoardSquare argument to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> ChessBoardImpl::generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare) const {
-    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves;
-    std::vector<std::unique_ptr<BoardMove>> pseudoLegalBoardMoves = generateAllPseudoLegalMovesAtSquare(boardSquare, false);
-    for (std::unique_ptr<BoardMove> &pseudoLegalBoardMove : pseudoLegalBoardMoves) {
-        if (!doesMoveLeaveTeamInCheck(pseudoLegalBoardMove)) {
-            legalBoardMoves.emplace_back(std::move(pseudoLegalBoardMove));
-        }
+void ChessBoardImpl::generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const {
+    int firstMoveIndex = moves.size();
+    generateAllPseudoLegalMovesAtSquare(boardSquare, false, moves);
+    if (moves.size() > firstMoveIndex) {
+        filterLegalMoves(moves, firstMoveIndex, PieceCodeUtilities::getTeam(getPieceCodeAt(boardSquare)));
     }
-    return legalBoardMoves;
 }
 
 /*
- * Generate all legal moves that can be made by the Team argument
+ * Appends all legal moves that can be made by the Team argument to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> ChessBoardImpl::generateAllLegalMovesImpl(Team team) const { 
-    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves;
-    std::vector<std::unique_ptr<BoardMove>> pseudoLegalBoardMoves = generateAllPseudoLegalMoves(team, false);
-    for (std::unique_ptr<BoardMove> &pseudoLegalBoardMove : pseudoLegalBoardMoves) {
-        if (!doesMoveLeaveTeamInCheck(pseudoLegalBoardMove)) {
-            legalBoardMoves.emplace_back(std::move(pseudoLegalBoardMove));
-        }
-    }
-    return legalBoardMoves;
+void ChessBoardImpl::generateAllLegalMovesImpl(Team team, MoveList &moves) const { 
+    int firstMoveIndex = moves.size();
+    generateAllPseudoLegalMoves(team, false, moves);
+    filterLegalMoves(moves, firstMoveIndex, team);
+}
+
+/*
+ * Appends all pseudo legal moves that can be made by the Team argument to the MoveList argument
+ */
+void ChessBoardImpl::generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const {
+    generateAllPseudoLegalMoves(team, false, moves);
+}
+
+/*
+ * True if the pseudo legal move represented by the MoveCode argument does not leave its own King attacked, false otherwise
+ */
+bool ChessBoardImpl::isPseudoLegalMoveLegalImpl(MoveCode moveCode) const {
+    Team team = PieceCodeUtilities::getTeam(getPieceCodeAt(MoveCodeUtilities::getFromSquare(moveCode, numColsOnBoard)));
+    return isPseudoLegalMoveLegal(moveCode, getCheckInfo(team));
 }
 
 /*
@@ -418,18 +961,49 @@ std::vector<std::unique_ptr<BoardMove>> ChessBoardImpl::generateWinningMovesImpl
     return winningBoardMoves;
 }
 
+/*
+ * Generate all legal moves that can be made by the Team argument, each tagged with the MoveFlags that describe it
+ * Every move is made in place once, and the other Team's legal replies are generated once, to decide all of its MoveFlags
+ */
+std::vector<ClassifiedMove> ChessBoardImpl::generateClassifiedMovesImpl(Team team) const {
+    std::vector<ClassifiedMove> classifiedMoves;
+    Team otherTeam = getOtherTeam(team);
+
+    MoveList legalMoves;
+    generateAllLegalMoves(team, legalMoves);
+    classifiedMoves.reserve(legalMoves.size());
+    for (MoveCode legalMove : legalMoves) {
+        MoveFlags moveFlags = MoveCodeUtilities::isCapture(legalMove) ? CAPTURES_PIECE_FLAG : NO_MOVE_FLAGS;
+        ScopedBoardMove scopedBoardMove(*this, legalMove);
+
+        MoveList replyMoves;
+        generateAllLegalMoves(otherTeam, replyMoves);
+        if (isInCheck(otherTeam)) {
+            moveFlags |= APPLIES_CHECK_FLAG;
+            if (replyMoves.empty()) {
+                moveFlags |= WINS_GAME_FLAG;
+            }
+        }
+        if (std::any_of(replyMoves.begin(), replyMoves.end(), [](MoveCode replyMove) { return MoveCodeUtilities::isCapture(replyMove); })) {
+            moveFlags |= LEAVES_PIECE_ATTACKED_FLAG;
+        }
+        classifiedMoves.emplace_back(legalMove, moveFlags);
+    }
+    return classifiedMoves;
+}
+
 /*
  * Set the Piece at the BoardSquare argument location based on the PieceData argument
  */
 void ChessBoardImpl::setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) {
-    grid[boardSquare.boardRow][boardSquare.boardCol] = PieceFactory::createPiece(pieceData);
+    setPieceCodeAt(getGridIndex(boardSquare), PieceCodeUtilities::encode(pieceData));
 }
 
 /*
  * Clear the BoardSqure argument location of any Pieces
  */
 void ChessBoardImpl::clearPositionImpl(BoardSquare const &boardSquare) {
-    grid[boardSquare.boardRow][boardSquare.boardCol] = nullptr;
+    setPieceCodeAt(getGridIndex(boardSquare), EMPTY_PIECE_CODE);
 }
 
 /*
@@ -451,13 +1025,13 @@ std::optional<std::unique_ptr<BoardMove>> ChessBoardImpl::createBoardMoveImpl(Bo
         return std::nullopt;
     }
 
-    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMovesAtSquare(fromSquare);
-    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
-        if (fromSquare == legalBoardMove->getFromSquare() && 
-            toSquare == legalBoardMove->getToSquare() && 
-            promotionPieceType == legalBoardMove->getPromotionPieceType()) {
+    MoveList legalMoves;
+    generateAllLegalMovesAtSquare(fromSquare, legalMoves);
+    for (MoveCode legalMove : legalMoves) {
+        if (toSquare == MoveCodeUtilities::getToSquare(legalMove, numColsOnBoard) && 
+            promotionPieceType == MoveCodeUtilities::getPromotionPieceType(legalMove)) {
 
-            return std::move(legalBoardMove);
+            return MoveCodeUtilities::decode(legalMove, *this);
         }
     }
     return std::nullopt;
@@ -480,8 +1054,14 @@ bool ChessBoardImpl::isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove
  * Apply the BoardMove argument to the ChessBoard
  */
 void ChessBoardImpl::makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) {
-    boardMove->makeBoardMove(*this);                                                // Apply the move
-    completedMoves.emplace_back(boardMove->clone());                                // Track it for undoing 
+    makeMoveImpl(MoveCodeUtilities::encode(*boardMove, *this));
+}
+
+/*
+ * Apply the move represented by the MoveCode argument to the ChessBoard
+ */
+void ChessBoardImpl::makeMoveImpl(MoveCode moveCode) {
+    undoRecords.emplace_back(applyMove(moveCode));                                  // Apply the move and track it for undoing
     clearRedoMoves();                                                               // Clear redo moves (can't redo after making a move)
 }
 
@@ -491,13 +1071,13 @@ void ChessBoardImpl::makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) {
  * - False otherwise (and BoardState remains unchanged)
  */
 bool ChessBoardImpl::undoMoveImpl() {
-    if (completedMoves.empty()) {
+    if (undoRecords.empty()) {
         return false;
     } else {
-        std::unique_ptr<BoardMove> lastMove = std::move(completedMoves.back());     // Get the last made move
-        completedMoves.pop_back();                                                  // Pop it off the completed moves stack
-        lastMove->undoBoardMove(*this);                                             // Undo the move
-        redoMoves.emplace_back(std::move(lastMove));                                // Push it to the redo moves stack
+        UndoRecord const &lastUndoRecord = undoRecords.back();                      // Get the record of the last made move
+        revertMove(lastUndoRecord);                                                 // Undo the move
+        redoMoveCodes.emplace_back(lastUndoRecord.moveCode);                        // Push it to the redo moves stack
+        undoRecords.pop_back();                                                     // Pop it off the undo stack
         return true;
     }
 }
@@ -508,23 +1088,45 @@ bool ChessBoardImpl::undoMoveImpl() {
  * - False otherwise (and BoardState remains unchanged)
  */
 bool ChessBoardImpl::redoMoveImpl() {
-    if (redoMoves.empty()) {
+    if (redoMoveCodes.empty()) {
         return false;
     } else {
-        std::unique_ptr<BoardMove> lastUndoneMove = std::move(redoMoves.back());    // Get the last move to be undone
-        redoMoves.pop_back();                                                       // Pop it off the redo moves stack
-        lastUndoneMove->makeBoardMove(*this);                                       // Apply the move
-        completedMoves.emplace_back(std::move(lastUndoneMove));                     // Push it to the completed moves stack
+        MoveCode lastUndoneMoveCode = redoMoveCodes.back();                         // Get the last move to be undone
+        redoMoveCodes.pop_back();                                                   // Pop it off the redo moves stack
+        undoRecords.emplace_back(applyMove(lastUndoneMoveCode));                    // Apply the move and track it for undoing
         return true;
     }
 }
 
+/*
+ * Copy the position into a new ChessBoard, leaving the move history behind
+ */
+std::unique_ptr<ChessBoard> ChessBoardImpl::clonePositionImpl() const {
+    return std::unique_ptr<ChessBoard>(new ChessBoardImpl(*this, false));
+}
+
+/*
+ * Set the Team whose turn it is to move, keeping the position hash in sync
+ */
+void ChessBoardImpl::setTeamToMoveImpl(Team team) {
+    if (team != positionState.teamToMove) {
+        positionHash ^= zobristKeys->getSideToMoveKey();
+        positionState.teamToMove = team;
+    }
+}
+
 /* Getters */
-std::vector<std::unique_ptr<BoardMove>> const& ChessBoardImpl::getCompletedMovesImpl() const { return completedMoves; }
+std::optional<BoardSquare> ChessBoardImpl::getEnPassantSquareImpl() const { return positionState.enPassantSquare; }
+int ChessBoardImpl::getHalfmoveClockImpl() const { return positionState.halfmoveClock; }
+std::uint64_t ChessBoardImpl::getPositionHashImpl() const { return positionHash; }
+BoardGeometry const& ChessBoardImpl::getBoardGeometryImpl() const { return *boardGeometry; }
+std::vector<BoardSquare> const& ChessBoardImpl::getPieceSquaresImpl(Team team) const { return pieceSquares[getTeamIndex(team)]; }
+std::vector<BoardSquare> const& ChessBoardImpl::getKingSquaresImpl(Team team) const { return kingSquares[getTeamIndex(team)]; }
+Team ChessBoardImpl::getTeamToMoveImpl() const { return positionState.teamToMove; }
 Team ChessBoardImpl::getTeamOneImpl() const {  return teamOne; }
 Team ChessBoardImpl::getTeamTwoImpl() const  { return teamTwo; }
-int ChessBoardImpl::getNumRowsOnBoardImpl() const { return grid.size(); }
-int ChessBoardImpl::getNumColsOnBoardImpl() const { return grid.size() >= 1 ? grid[0].size() : 0; }
+int ChessBoardImpl::getNumRowsOnBoardImpl() const { return numRowsOnBoard; }
+int ChessBoardImpl::getNumColsOnBoardImpl() const { return numColsOnBoard; }
 
 /* BoardSquareIterator */
 ChessBoard::BoardSquareIterator ChessBoardImpl::beginImpl() { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
@@ -3,42 +3,152 @@
 #ifndef ChessBoardImpl_h
 #define ChessBoardImpl_h
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
+#include "BoardGeometry.h"
 #include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
+#include "ClassifiedMove.h"
 #include "Cloneable.h"
 #include "Constants.h"
-#include "Piece.h"
+#include "MoveCode.h"
+#include "MoveDirection.h"
+#include "MoveList.h"
+#include "PieceCode.h"
 #include "PieceData.h"
 #include "PieceInfo.h"
+#include "PositionState.h"
+#include "StaticChessBoard.h"
+#include "ZobristKeys.h"
 
 
 /**
  * ChessBoardImpl ChessBoard Class
+ * Also a StaticChessBoard, so that move generation inside ChessBoardImpl probes squares without virtual calls
  */
-class ChessBoardImpl final : public Cloneable<ChessBoard, ChessBoardImpl> {
+class ChessBoardImpl final : public Cloneable<ChessBoard, ChessBoardImpl>, public StaticChessBoard<ChessBoardImpl> {
+
+    friend class StaticChessBoard<ChessBoardImpl>;
 
 private:
+
+    /**
+     * UndoRecord Struct
+     * Everything needed to revert one move by direct writes, kept by value on the undo stack
+     */
+    struct UndoRecord final {
+        MoveCode moveCode;
+        PieceCode movedPieceCode;           // Moved Piece before the move, restores its hasMoved and pre promotion PieceType
+        PieceCode capturedPieceCode;        // EMPTY_PIECE_CODE if nothing was captured
+        PieceCode replacedPieceCode;        // Prior occupant of the to square, differs from capturedPieceCode only for en passant onto an occupied square
+        PieceCode castledRookPieceCode;     // Rook before the move if moveCode is a castle, EMPTY_PIECE_CODE otherwise
+        int enPassantGridIndex;             // Prior PositionState, -1 if there was no en passant square
+        Team teamToMove;
+        int halfmoveClock;
+        std::uint64_t positionHash;
+    };
+
+    /**
+     * ScopedBoardMove Class
+     * Applies a move to a ChessBoardImpl in place for the lifetime of the guard, reverting it on destruction
+     * Leaves the undo and redo stacks untouched
+     */
+    class ScopedBoardMove final {
+    private:
+        ChessBoardImpl &chessBoard;
+        UndoRecord undoRecord;
+
+    public:
+        explicit ScopedBoardMove(ChessBoardImpl const &chessBoard, MoveCode moveCode);
+        ScopedBoardMove(ScopedBoardMove const &other) = delete;
+        ScopedBoardMove(ScopedBoardMove &&other) = delete;
+        ScopedBoardMove& operator=(ScopedBoardMove const &other) = delete;
+        ScopedBoardMove& operator=(ScopedBoardMove &&other) = delete;
+        ~ScopedBoardMove();
+    };
+
+    /**
+     * CheckInfo Struct
+     * Checkers and absolute pins against a Team's King, computed once per position by the legal move generator
+     */
+    struct CheckInfo final {
+        std::optional<BoardSquare> kingSquare;                      // nullopt unless the Team has exactly one King
+        int numCheckers = 0;
+        std::optional<BoardSquare> checkerSquare;                   // Set if there is exactly one checker
+        std::optional<MoveDirection> checkerDirection;              // Set if the single checker is a slider, direction from the King towards it
+        std::vector<std::pair<BoardSquare, MoveDirection>> pins;    // Pinned Piece square, direction from the King towards it
+    };
+
+    static std::vector<std::pair<PieceDirection, MoveDirection>> const pawnAttackOrigins;
+    static std::vector<MoveDirection> const orthogonalDirections;
+    static std::vector<MoveDirection> const diagonalDirections;
+    static std::vector<MoveDirection> const knightOffsets;
+    static std::vector<MoveDirection> const advancedKnightOffsets;
+    static std::vector<MoveDirection> const advancedKingOffsets;
+
+    static int const boardPadding = 3;      // Sentinel border width, covers the largest Piece offset (AdvancedKnight, AdvancedPawn)
+
     Team teamOne = Team::TEAM_ONE;
     Team teamTwo = Team::TEAM_TWO;
 
-    std::vector<std::vector<std::unique_ptr<Piece>>> grid;
+    int numRowsOnBoard;
+    int numColsOnBoard;
+    int numPaddedRows;
+    int numPaddedCols;
+    std::vector<PieceCode> grid;            // Row major, bordered by OFF_BOARD_PIECE_CODE sentinels
+
+    std::array<std::vector<BoardSquare>, 2> pieceSquares;   // Locations of every Piece, per Team
+    std::array<std::vector<BoardSquare>, 2> kingSquares;    // Locations of every King, per Team
+    std::vector<int> pieceSquareIndices;                    // Indexed by grid index, position of the square in its pieceSquares list
+
+    PositionState positionState;
+
+    // Move history, only needed to undo and redo moves, not copied by clonePosition
+    std::vector<UndoRecord> undoRecords;
+    std::vector<MoveCode> redoMoveCodes;
+
+    std::shared_ptr<ZobristKeys const> zobristKeys; // Shared by all ChessBoardImpls of the same size
+    std::shared_ptr<BoardGeometry const> boardGeometry;     // Shared by all ChessBoardImpls of the same size
+    std::uint64_t positionHash;                     // Maintained incrementally as the ChessBoardImpl state changes
 
-    std::vector<std::unique_ptr<BoardMove>> completedMoves;
-    std::vector<std::unique_ptr<BoardMove>> redoMoves;
+    mutable std::array<CheckInfo, 2> checkInfos;                        // Per Team, rebuilt by getCheckInfo when invalid
+    mutable std::array<bool, 2> isCheckInfoValid = { false, false };    // Cleared whenever a square changes, never copied
 
 
     /* Specific To ChessBoardImpl */
+    explicit ChessBoardImpl(ChessBoardImpl const &other, bool shouldCopyMoveHistory);
+
+    int getGridIndex(BoardSquare const &boardSquare) const;
+    int getGridOffset(MoveDirection const &moveDirection) const;
+    BoardSquare getBoardSquare(int gridIndex) const;
+    static int getRayDistance(BoardSquare const &originSquare, MoveDirection const &moveDirection, BoardSquare const &boardSquare);
+    PieceCode getPieceCodeAt(BoardSquare const &boardSquare) const;
+    int getTeamIndex(Team team) const;
+    void addToPieceSquares(BoardSquare const &boardSquare, PieceCode pieceCode);
+    void removeFromPieceSquares(BoardSquare const &boardSquare, PieceCode pieceCode);
+    void setPieceCodeAt(int gridIndex, PieceCode newPieceCode);
     Team getOtherTeam(Team team) const;
-
-    std::vector<std::unique_ptr<BoardMove>> generateAllPseudoLegalMovesAtSquare(BoardSquare const &boardSquare, bool onlyAttackingMoves) const;
-    std::vector<std::unique_ptr<BoardMove>> generateAllPseudoLegalMoves(Team team, bool onlyAttackingMoves) const;   
+    void setEnPassantSquare(std::optional<BoardSquare> const &newEnPassantSquare);
+    UndoRecord applyMove(MoveCode moveCode);
+    void revertMove(UndoRecord const &undoRecord);
 
     void clearRedoMoves();
+
+    void generateAllPseudoLegalMovesAtSquare(BoardSquare const &boardSquare, bool onlyAttackingMoves, MoveList &moves) const;
+    void generateAllPseudoLegalMoves(Team team, bool onlyAttackingMoves, MoveList &moves) const;   
+
+    int findAttackers(int gridIndex, Team attackingTeam, int ignoredGridIndex, int maxAttackers, std::array<int, 2> &attackerGridIndices) const;
+    void findPinsAndSlidingChecker(CheckInfo &checkInfo, Team team, std::vector<MoveDirection> const &rayDirections, PieceType sliderType) const;
+    CheckInfo const& getCheckInfo(Team team) const;
+    bool isPseudoLegalMoveLegal(MoveCode moveCode, CheckInfo const &checkInfo) const;
+    void filterLegalMoves(MoveList &moves, int firstMoveIndex, Team team) const;
+
     bool canMakeMove(Team team) const;
 
     bool doesMoveApplyCheck(std::unique_ptr<BoardMove> const &boardMove) const;
@@ -46,6 +156,7 @@ private:
     bool doesMoveLeavePieceAttacked(std::unique_ptr<BoardMove> const &boardMove) const;
     bool doesMoveWinGame(std::unique_ptr<BoardMove> const &boardMove) const;
     bool doesMoveLeaveTeamInCheck(std::unique_ptr<BoardMove> const &boardMove) const;   
+    bool doesMoveLeaveTeamInCheck(MoveCode moveCode) const;
 
 
     /* ChessBoard Interface Implementation */
@@ -62,12 +173,15 @@ private:
     bool isInCheckMateImpl(Team team) const override;
     bool isInStaleMateImpl(Team team) const override;
     
-    std::vector<std::unique_ptr<BoardMove>> generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare) const override;
-    std::vector<std::unique_ptr<BoardMove>> generateAllLegalMovesImpl(Team team) const override; 
+    void generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const override;
+    void generateAllLegalMovesImpl(Team team, MoveList &moves) const override; 
+    void generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const override;
+    bool isPseudoLegalMoveLegalImpl(MoveCode moveCode) const override;
     std::vector<std::unique_ptr<BoardMove>> generateCheckApplyingMovesImpl(Team team) const override;
     std::vector<std::unique_ptr<BoardMove>> generateCapturingMovesImpl(Team team) const override;
     std::vector<std::unique_ptr<BoardMove>> generateCaptureAvoidingMovesImpl(Team team) const override;
     std::vector<std::unique_ptr<BoardMove>> generateWinningMovesImpl(Team team) const override;
+    std::vector<ClassifiedMove> generateClassifiedMovesImpl(Team team) const override;
 
     void setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) override;
     void clearPositionImpl(BoardSquare const &boardSquare) override;
@@ -76,10 +190,20 @@ private:
     std::optional<std::unique_ptr<BoardMove>> createBoardMoveImpl(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType = std::nullopt) const override;
     bool isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove) const override;
     void makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) override;    
+    void makeMoveImpl(MoveCode moveCode) override;
     bool undoMoveImpl() override;                               // True if move is available to be undone (only performs undo if move available to be undone)
     bool redoMoveImpl() override;                               // True if move is available to be redone (only performs redo if move available to be redone)
 
-    std::vector<std::unique_ptr<BoardMove>> const& getCompletedMovesImpl() const override;
+    std::unique_ptr<ChessBoard> clonePositionImpl() const override;
+    std::optional<BoardSquare> getEnPassantSquareImpl() const override;
+    int getHalfmoveClockImpl() const override;
+    std::vector<BoardSquare> const& getPieceSquaresImpl(Team team) const override;
+    std::vector<BoardSquare> const& getKingSquaresImpl(Team team) const override;
+    std::uint64_t getPositionHashImpl() const override;
+    BoardGeometry const& getBoardGeometryImpl() const override;
+
+    Team getTeamToMoveImpl() const override;
+    void setTeamToMoveImpl(Team team) override;
 
     Team getTeamOneImpl() const override;
     Team getTeamTwoImpl() const override;
@@ -102,12 +226,25 @@ private:
     ReverseBoardSquareIterator crendImpl() const override;
 
 public:
-    explicit ChessBoardImpl(int numRowsOnBoard, int numColsOnBoard);
+    explicit ChessBoardImpl(int numRowsOnBoard, int numColsOnBoard, std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry);
     ChessBoardImpl(ChessBoardImpl const &other);
     ChessBoardImpl(ChessBoardImpl &&other) noexcept;
     ChessBoardImpl& operator=(ChessBoardImpl const &other);
     ChessBoardImpl& operator=(ChessBoardImpl &&other) noexcept;
     virtual ~ChessBoardImpl() = default;
+
+    // Square queries resolve to StaticChessBoard when called on a ChessBoardImpl, and to the virtual ChessBoard interface otherwise
+    using StaticChessBoard<ChessBoardImpl>::getPieceDataAt;
+    using StaticChessBoard<ChessBoardImpl>::getPieceInfoAt;
+    using StaticChessBoard<ChessBoardImpl>::isSquareOnBoard;
+    using StaticChessBoard<ChessBoardImpl>::isSquareEmpty;
+    using StaticChessBoard<ChessBoardImpl>::isSquareSameTeam;
+    using StaticChessBoard<ChessBoardImpl>::isSquareOtherTeam;
+    using StaticChessBoard<ChessBoardImpl>::isSquareAttacked;
+    using StaticChessBoard<ChessBoardImpl>::getEnPassantSquare;
+    using StaticChessBoard<ChessBoardImpl>::getBoardGeometry;
+    using StaticChessBoard<ChessBoardImpl>::getNumRowsOnBoard;
+    using StaticChessBoard<ChessBoardImpl>::getNumColsOnBoard;
 };
 
 
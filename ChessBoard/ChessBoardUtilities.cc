@@ -8,6 +8,7 @@
 #include "ChessBoard.h"
 #include "Constants.h"
 #include "PieceData.h"
+#include "PositionStatus.h"
 
 
 /*
@@ -27,7 +28,8 @@ bool ChessBoardUtilities::isBoardInLegalSetupState(std::unique_ptr<ChessBoard> c
     int teamTwoKingCount = 0;
 
     // Check for stalemate
-    if (chessBoard->isInStaleMate(chessBoard->getTeamOne()) || chessBoard->isInStaleMate(chessBoard->getTeamTwo())) {
+    if (chessBoard->getPositionStatus(chessBoard->getTeamOne()).gameResult == GameResult::STALEMATE || 
+        chessBoard->getPositionStatus(chessBoard->getTeamTwo()).gameResult == GameResult::STALEMATE) {
         return false;
     }
 
@@ -117,21 +119,12 @@ bool ChessBoardUtilities::applyStandardSetup(std::unique_ptr<ChessBoard> &chessB
  * True if the game is over when it is the Team arguments turn
  */
 bool ChessBoardUtilities::isGameOver(std::unique_ptr<ChessBoard> const &chessBoard, Team currentTurn) {
-    return 
-        chessBoard->isInCheckMate(currentTurn) || 
-        chessBoard->isInStaleMate(currentTurn);
+    return chessBoard->getPositionStatus(currentTurn).gameResult != GameResult::IN_PROGRESS;
 }
 
 /*
  * Return the number of Pieces that are on the Team arguments team
  */
 int ChessBoardUtilities::getNumPiecesOnBoard(std::unique_ptr<ChessBoard> const &chessBoard, Team team) {
-    int numPieces = 0;
-    for (ChessBoard::BoardSquareIterator it = chessBoard->begin(); it != chessBoard->end(); ++it) {
-        std::optional<PieceData> pieceData = chessBoard->getPieceDataAt(*it);
-        if (pieceData.has_value() && pieceData.value().team == team) {
-            numPieces++;
-        }
-    }
-    return numPieces;
+    return chessBoard->getPieceSquares(team).size();
 }
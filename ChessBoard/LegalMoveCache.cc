@@ -0,0 +1,153 @@
+// LegalMoveCache.cc
+
+#include "LegalMoveCache.h"
+
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+
+
+#pragma mark - Entry
+
+/*
+ * Basic ctor
+ */
+LegalMoveCache::Entry::Entry(std::uint64_t positionHash, Team team, bool isInCheck, MoveList const &moves) :
+    positionHash(positionHash), team(team), isInCheck(isInCheck), moveCodes(moves.begin(), moves.end()) { }
+
+
+#pragma mark - LegalMoveCache
+
+/*
+ * Basic ctor
+ */
+LegalMoveCache::LegalMoveCache(int capacity) :
+    capacity(capacity), numHits(0), numMisses(0) { }
+
+/*
+ * Copy ctor
+ * Starts out empty, the entries are cheap to regenerate and copying them would allocate one vector per entry
+ */
+LegalMoveCache::LegalMoveCache(LegalMoveCache const &other) :
+    capacity(other.capacity), numHits(0), numMisses(0) { }
+
+/*
+ * Move ctor
+ */
+LegalMoveCache::LegalMoveCache(LegalMoveCache &&other) noexcept :
+    capacity(other.capacity), entries(std::move(other.entries)), numHits(other.numHits), numMisses(other.numMisses) { }
+
+/*
+ * Copy assignment
+ * Drops every entry, see the copy ctor
+ */
+LegalMoveCache& LegalMoveCache::operator=(LegalMoveCache const &other) {
+    if (this != &other) {
+        capacity = other.capacity;
+        entries.clear();
+        numHits = 0;
+        numMisses = 0;
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+LegalMoveCache& LegalMoveCache::operator=(LegalMoveCache &&other) noexcept {
+    if (this != &other) {
+        capacity = other.capacity;
+        entries = std::move(other.entries);
+        numHits = other.numHits;
+        numMisses = other.numMisses;
+    }
+    return *this;
+}
+
+/*
+ * Returns the slot of the (position hash, Team) pair
+ * Both Teams of a position land in neighbouring slots, so asking for one does not evict the other
+ */
+int LegalMoveCache::getEntryIndex(std::uint64_t positionHash, Team team) const {
+    return static_cast<int>((positionHash + static_cast<std::uint64_t>(team)) % capacity);
+}
+
+/*
+ * Returns the Entry of the Team argument in the position with the hash argument, nullptr if it is not cached
+ */
+LegalMoveCache::Entry const* LegalMoveCache::find(std::uint64_t positionHash, Team team) {
+    if (!entries.empty()) {
+        std::optional<Entry> const &entry = entries[getEntryIndex(positionHash, team)];
+        if (entry.has_value() && entry->positionHash == positionHash && entry->team == team) {
+            ++numHits;
+            return &entry.value();
+        }
+    }
+    ++numMisses;
+    return nullptr;
+}
+
+/*
+ * Stores the legal moves of the Team argument in the position with the hash argument, replacing whatever occupied its slot
+ * The replaced Entry's storage is reused, so a warm cache does not allocate
+ * Must not be called with a capacity of 0
+ */
+LegalMoveCache::Entry const& LegalMoveCache::insert(std::uint64_t positionHash, Team team, bool isInCheck, MoveList const &moves) {
+    assert(capacity > 0);
+    if (entries.empty()) {
+        entries.resize(capacity);
+    }
+    std::optional<Entry> &entry = entries[getEntryIndex(positionHash, team)];
+    if (entry.has_value()) {
+        entry->positionHash = positionHash;
+        entry->team = team;
+        entry->isInCheck = isInCheck;
+        entry->moveCodes.assign(moves.begin(), moves.end());
+    } else {
+        entry.emplace(positionHash, team, isInCheck, moves);
+    }
+    return entry.value();
+}
+
+/*
+ * Drops every Entry, keeping the capacity and the counters
+ */
+void LegalMoveCache::clear() {
+    for (std::optional<Entry> &entry : entries) {
+        entry.reset();
+    }
+}
+
+/*
+ * Resizes the cache to hold the number of entries argument
+ */
+void LegalMoveCache::setCapacity(int capacity) {
+    this->capacity = capacity;
+    entries.clear();
+    numHits = 0;
+    numMisses = 0;
+}
+
+/*
+ * Returns the number of occupied slots
+ */
+int LegalMoveCache::getNumEntries() const {
+    int numEntries = 0;
+    for (std::optional<Entry> const &entry : entries) {
+        if (entry.has_value()) {
+            ++numEntries;
+        }
+    }
+    return numEntries;
+}
+
+/* Getters */
+int LegalMoveCache::getCapacity() const { return capacity; }
+std::uint64_t LegalMoveCache::getNumHits() const { return numHits; }
+std::uint64_t LegalMoveCache::getNumMisses() const { return numMisses; }
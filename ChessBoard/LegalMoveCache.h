@@ -0,0 +1,75 @@
+// LegalMoveCache.h
+
+#ifndef LegalMoveCache_h
+#define LegalMoveCache_h
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+
+
+/**
+ * LegalMoveCache Class
+ * Bounded cache of the legal moves of a Team in a ChessBoard position, keyed by the position hash
+ * - Direct mapped: each (position hash, Team) pair has exactly one slot, a newer position replaces whatever occupied it
+ * - The position hash covers every Piece, the en passant square and the side to move, so entries never need to be invalidated
+ * - A capacity of 0 disables the cache
+ * - The slots are only allocated on the first insert, and a copy starts out empty with the same capacity, so copying a ChessBoard
+ *   does not copy its cache
+ */
+class LegalMoveCache final {
+public:
+    static int const defaultCapacity = 128;
+
+    /**
+     * Entry Struct
+     * The legal moves of a Team in one position, along with whether that Team is in check
+     */
+    struct Entry final {
+        std::uint64_t positionHash;
+        Team team;
+        bool isInCheck;
+        std::vector<MoveCode> moveCodes;
+
+        explicit Entry(std::uint64_t positionHash, Team team, bool isInCheck, MoveList const &moves);
+        Entry(Entry const &other) = default;
+        Entry(Entry &&other) noexcept = default;
+        Entry& operator=(Entry const &other) = default;
+        Entry& operator=(Entry &&other) noexcept = default;
+        ~Entry() = default;
+    };
+
+private:
+    int capacity;
+    std::vector<std::optional<Entry>> entries;      // Empty until the first insert
+    std::uint64_t numHits;
+    std::uint64_t numMisses;
+
+    int getEntryIndex(std::uint64_t positionHash, Team team) const;
+
+public:
+    explicit LegalMoveCache(int capacity = defaultCapacity);
+    LegalMoveCache(LegalMoveCache const &other);                    // Copies the capacity only
+    LegalMoveCache(LegalMoveCache &&other) noexcept;
+    LegalMoveCache& operator=(LegalMoveCache const &other);         // Copies the capacity only
+    LegalMoveCache& operator=(LegalMoveCache &&other) noexcept;
+    ~LegalMoveCache() = default;
+
+    Entry const* find(std::uint64_t positionHash, Team team);       // nullptr on a miss, counts towards the hit / miss counters
+    Entry const& insert(std::uint64_t positionHash, Team team, bool isInCheck, MoveList const &moves);
+    void clear();
+
+    int getCapacity() const;
+    void setCapacity(int capacity);                                 // Drops every entry and resets the counters
+
+    int getNumEntries() const;
+    std::uint64_t getNumHits() const;
+    std::uint64_t getNumMisses() const;
+};
+
+
+#endif /* LegalMoveCache_h */
@@ -0,0 +1,262 @@
+// MagicAttackTables.cc
+
+#include "MagicAttackTables.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Constants.h"
+
+
+/*
+ * Static
+ *
+ * The 4 orthogonal directions followed by the 4 diagonal directions, as (rowDirection, colDirection)
+ */
+std::array<std::pair<int, int>, 8> const MagicAttackTables::rayDirections = {
+    std::make_pair(-1, 0), std::make_pair(1, 0), std::make_pair(0, -1), std::make_pair(0, 1),
+    std::make_pair(-1, -1), std::make_pair(-1, 1), std::make_pair(1, -1), std::make_pair(1, 1)
+};
+
+/*
+ * Static
+ *
+ * Per row, the seeds the magic number search for the squares of that row starts from
+ * Chosen ahead of time as seeds that find every magic number of the row after few candidates, keeping construction to tens of milliseconds
+ */
+std::array<std::uint64_t, 8> const MagicAttackTables::rookSeeds = { 1776, 1387, 250, 2719, 1643, 2078, 974, 30 };
+std::array<std::uint64_t, 8> const MagicAttackTables::bishopSeeds = { 2514, 1421, 2450, 11, 1053, 2402, 383, 1586 };
+
+/*
+ * Static
+ *
+ * True if the row and col arguments lie on the 8x8 ChessBoard, false otherwise
+ */
+bool MagicAttackTables::isOnBoard(int boardRow, int boardCol) {
+    return 0 <= boardRow && boardRow < numRowsOnBoard && 0 <= boardCol && boardCol < numColsOnBoard;
+}
+
+/*
+ * Static
+ *
+ * Returns the word with only the bit of the square at the row and col arguments set
+ */
+std::uint64_t MagicAttackTables::getSquareBit(int boardRow, int boardCol) {
+    return std::uint64_t(1) << (boardRow * numColsOnBoard + boardCol);
+}
+
+/*
+ * Static
+ *
+ * Returns the squares a single jump of the jumps argument away from the square index argument
+ */
+std::uint64_t MagicAttackTables::getJumpTargets(int squareIndex, std::vector<std::pair<int, int>> const &jumps) {
+    std::uint64_t targets = 0;
+    for (std::pair<int, int> const &jump : jumps) {
+        int toRow = squareIndex / numColsOnBoard + jump.first;
+        int toCol = squareIndex % numColsOnBoard + jump.second;
+        if (isOnBoard(toRow, toCol)) {
+            targets |= getSquareBit(toRow, toCol);
+        }
+    }
+    return targets;
+}
+
+/*
+ * Static
+ *
+ * Advances the xorshift64* state argument and returns the next pseudo random number
+ */
+std::uint64_t MagicAttackTables::getNextRandom(std::uint64_t &randomState) {
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState * 2685821657736338717ULL;
+}
+
+/*
+ * Basic ctor
+ */
+MagicAttackTables::MagicAttackTables() {
+    std::vector<std::pair<int, int>> const knightJumps = { {-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1} };
+    std::vector<std::pair<int, int>> const kingJumps = { {-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1} };
+    std::vector<std::pair<int, int>> const northPawnJumps = { {-1, -1}, {-1, 1} };
+    std::vector<std::pair<int, int>> const southPawnJumps = { {1, -1}, {1, 1} };
+
+    for (int squareIndex = 0; squareIndex < numSquares; ++squareIndex) {
+        knightAttacks[squareIndex] = getJumpTargets(squareIndex, knightJumps);
+        kingAttacks[squareIndex] = getJumpTargets(squareIndex, kingJumps);
+        pawnAttacks[static_cast<int>(PieceDirection::NORTH)][squareIndex] = getJumpTargets(squareIndex, northPawnJumps);
+        pawnAttacks[static_cast<int>(PieceDirection::SOUTH)][squareIndex] = getJumpTargets(squareIndex, southPawnJumps);
+
+        for (int directionIndex = 0; directionIndex < numRayDirections; ++directionIndex) {
+            rays[squareIndex][directionIndex] = 0;
+            int toRow = squareIndex / numColsOnBoard + rayDirections[directionIndex].first;
+            int toCol = squareIndex % numColsOnBoard + rayDirections[directionIndex].second;
+            while (isOnBoard(toRow, toCol)) {
+                rays[squareIndex][directionIndex] |= getSquareBit(toRow, toCol);
+                toRow += rayDirections[directionIndex].first;
+                toCol += rayDirections[directionIndex].second;
+            }
+        }
+    }
+
+    buildMagics(rookMagics, rookAttacks, 0, rookSeeds);
+    buildMagics(bishopMagics, bishopAttacks, 4, bishopSeeds);
+}
+
+/*
+ * Copy ctor
+ */
+MagicAttackTables::MagicAttackTables(MagicAttackTables const &other) :
+    knightAttacks(other.knightAttacks), kingAttacks(other.kingAttacks), pawnAttacks(other.pawnAttacks), rays(other.rays),
+    rookMagics(other.rookMagics), bishopMagics(other.bishopMagics), rookAttacks(other.rookAttacks), bishopAttacks(other.bishopAttacks) { }
+
+/*
+ * Move ctor
+ */
+MagicAttackTables::MagicAttackTables(MagicAttackTables &&other) noexcept :
+    knightAttacks(other.knightAttacks), kingAttacks(other.kingAttacks), pawnAttacks(other.pawnAttacks), rays(other.rays),
+    rookMagics(other.rookMagics), bishopMagics(other.bishopMagics), rookAttacks(std::move(other.rookAttacks)), bishopAttacks(std::move(other.bishopAttacks)) { }
+
+/*
+ * Copy assignment
+ */
+MagicAttackTables& MagicAttackTables::operator=(MagicAttackTables const &other) {
+    if (this != &other) {
+        knightAttacks = other.knightAttacks;
+        kingAttacks = other.kingAttacks;
+        pawnAttacks = other.pawnAttacks;
+        rays = other.rays;
+        rookMagics = other.rookMagics;
+        bishopMagics = other.bishopMagics;
+        rookAttacks = other.rookAttacks;
+        bishopAttacks = other.bishopAttacks;
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+MagicAttackTables& MagicAttackTables::operator=(MagicAttackTables &&other) noexcept {
+    if (this != &other) {
+        knightAttacks = other.knightAttacks;
+        kingAttacks = other.kingAttacks;
+        pawnAttacks = other.pawnAttacks;
+        rays = other.rays;
+        rookMagics = other.rookMagics;
+        bishopMagics = other.bishopMagics;
+        rookAttacks = std::move(other.rookAttacks);
+        bishopAttacks = std::move(other.bishopAttacks);
+    }
+    return *this;
+}
+
+/*
+ * Returns the squares attacked from the square index argument along the 4 ray directions starting at firstDirectionIndex
+ * Each ray stops at, and includes, its first occupied square
+ */
+std::uint64_t MagicAttackTables::computeSliderAttacks(int squareIndex, std::uint64_t occupancy, int firstDirectionIndex) const {
+    std::uint64_t attacks = 0;
+    for (int directionIndex = firstDirectionIndex; directionIndex < firstDirectionIndex + 4; ++directionIndex) {
+        int toRow = squareIndex / numColsOnBoard + rayDirections[directionIndex].first;
+        int toCol = squareIndex % numColsOnBoard + rayDirections[directionIndex].second;
+        while (isOnBoard(toRow, toCol)) {
+            attacks |= getSquareBit(toRow, toCol);
+            if (occupancy & getSquareBit(toRow, toCol)) {
+                break;
+            }
+            toRow += rayDirections[directionIndex].first;
+            toCol += rayDirections[directionIndex].second;
+        }
+    }
+    return attacks;
+}
+
+/*
+ * Finds a magic number for every square and fills its slice of the attacks argument
+ * Candidates are sparse random numbers, accepted once every subset of the mask maps to an index holding the same attacks
+ */
+void MagicAttackTables::buildMagics(std::array<Magic, numSquares> &magics, std::vector<std::uint64_t> &attacks, int firstDirectionIndex, std::array<std::uint64_t, numRowsOnBoard> const &seeds) {
+    std::uint64_t randomState = 0;
+    attacks.clear();
+
+    std::vector<std::uint64_t> occupancies;
+    std::vector<std::uint64_t> occupancyAttacks;
+    std::vector<int> epochs;
+    for (int squareIndex = 0; squareIndex < numSquares; ++squareIndex) {
+        Magic &magic = magics[squareIndex];
+        if (squareIndex % numColsOnBoard == 0) {
+            randomState = seeds[squareIndex / numColsOnBoard];
+        }
+
+        // The edge square of each ray never blocks anything beyond it, so it is left out of the mask
+        magic.mask = 0;
+        for (int directionIndex = firstDirectionIndex; directionIndex < firstDirectionIndex + 4; ++directionIndex) {
+            std::uint64_t ray = rays[squareIndex][directionIndex];
+            for (std::uint64_t raySquares = ray; raySquares != 0; raySquares &= raySquares - 1) {
+                std::uint64_t raySquare = raySquares & (~raySquares + 1);
+                int rayRow = __builtin_ctzll(raySquare) / numColsOnBoard + rayDirections[directionIndex].first;
+                int rayCol = __builtin_ctzll(raySquare) % numColsOnBoard + rayDirections[directionIndex].second;
+                if (isOnBoard(rayRow, rayCol)) {
+                    magic.mask |= raySquare;
+                }
+            }
+        }
+        int numMaskSquares = __builtin_popcountll(magic.mask);
+        magic.shift = 64 - numMaskSquares;
+        magic.offset = static_cast<int>(attacks.size());
+
+        // Every subset of the mask, enumerated with the carry rippler, and the attacks it leaves
+        occupancies.clear();
+        occupancyAttacks.clear();
+        std::uint64_t occupancy = 0;
+        do {
+            occupancies.push_back(occupancy);
+            occupancyAttacks.push_back(computeSliderAttacks(squareIndex, occupancy, firstDirectionIndex));
+            occupancy = (occupancy - magic.mask) & magic.mask;
+        } while (occupancy != 0);
+
+        int numEntries = 1 << numMaskSquares;
+        attacks.resize(magic.offset + numEntries);
+        epochs.assign(numEntries, 0);
+        for (int epoch = 1; ; ++epoch) {
+            magic.magic = getNextRandom(randomState) & getNextRandom(randomState) & getNextRandom(randomState);
+            if (__builtin_popcountll((magic.mask * magic.magic) >> 56) < 6) {
+                continue;
+            }
+
+            bool isMagicValid = true;
+            for (int occupancyIndex = 0; isMagicValid && occupancyIndex < static_cast<int>(occupancies.size()); ++occupancyIndex) {
+                int entryIndex = static_cast<int>((occupancies[occupancyIndex] * magic.magic) >> magic.shift);
+                if (epochs[entryIndex] != epoch) {
+                    epochs[entryIndex] = epoch;
+                    attacks[magic.offset + entryIndex] = occupancyAttacks[occupancyIndex];
+                } else if (attacks[magic.offset + entryIndex] != occupancyAttacks[occupancyIndex]) {
+                    isMagicValid = false;
+                }
+            }
+            if (isMagicValid) {
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * Returns the squares along every ray from the square index argument that holds one of the sliders argument moving along it
+ * Only a Piece on one of these rays can be pinned to the square
+ */
+std::uint64_t MagicAttackTables::getSliderLines(int squareIndex, std::uint64_t orthogonalSliders, std::uint64_t diagonalSliders) const {
+    std::uint64_t sliderLines = 0;
+    for (int directionIndex = 0; directionIndex < numRayDirections; ++directionIndex) {
+        std::uint64_t ray = rays[squareIndex][directionIndex];
+        if (ray & (directionIndex < 4 ? orthogonalSliders : diagonalSliders)) {
+            sliderLines |= ray;
+        }
+    }
+    return sliderLines;
+}
@@ -0,0 +1,88 @@
+// MagicAttackTables.h
+
+#ifndef MagicAttackTables_h
+#define MagicAttackTables_h
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Constants.h"
+
+
+/**
+ * MagicAttackTables Class
+ * Attack tables of an 8x8 ChessBoard as 64 bit words, bit (row * 8 + col) set for each attacked square
+ * - Per square, the squares a Knight, a King and a NORTH or SOUTH Pawn attack
+ * - Per square, Rook and Bishop attacks for every set of blockers, looked up by multiplying the relevant occupied squares by a magic number
+ * - Per square and direction, the squares along the ray, for finding the lines a Piece can be pinned along
+ * The magic numbers are searched for with fixed seeds when the tables are built, so the tables are identical between runs
+ */
+class MagicAttackTables final {
+public:
+    static int const numSquares = 64;
+
+private:
+    static int const numRowsOnBoard = 8;
+    static int const numColsOnBoard = 8;
+    static int const numRayDirections = 8;
+    static std::array<std::pair<int, int>, numRayDirections> const rayDirections;
+    static std::array<std::uint64_t, numRowsOnBoard> const rookSeeds;
+    static std::array<std::uint64_t, numRowsOnBoard> const bishopSeeds;
+
+    /**
+     * Magic Struct
+     * Everything needed to look up the slider attacks of one square
+     */
+    struct Magic final {
+        std::uint64_t mask;                         // Squares whose occupancy can block the slider, excluding the edge of each ray
+        std::uint64_t magic;
+        int shift;                                  // 64 - number of squares in the mask
+        int offset;                                 // Index of the first attack set of the square in the attack table
+    };
+
+    std::array<std::uint64_t, numSquares> knightAttacks;
+    std::array<std::uint64_t, numSquares> kingAttacks;
+    std::array<std::array<std::uint64_t, numSquares>, 2> pawnAttacks;              // Indexed by PieceDirection NORTH or SOUTH
+    std::array<std::array<std::uint64_t, numRayDirections>, numSquares> rays;
+
+    std::array<Magic, numSquares> rookMagics;
+    std::array<Magic, numSquares> bishopMagics;
+    std::vector<std::uint64_t> rookAttacks;
+    std::vector<std::uint64_t> bishopAttacks;
+
+    static bool isOnBoard(int boardRow, int boardCol);
+    static std::uint64_t getSquareBit(int boardRow, int boardCol);
+    static std::uint64_t getJumpTargets(int squareIndex, std::vector<std::pair<int, int>> const &jumps);
+    static std::uint64_t getNextRandom(std::uint64_t &randomState);
+
+    std::uint64_t computeSliderAttacks(int squareIndex, std::uint64_t occupancy, int firstDirectionIndex) const;
+    void buildMagics(std::array<Magic, numSquares> &magics, std::vector<std::uint64_t> &attacks, int firstDirectionIndex, std::array<std::uint64_t, numRowsOnBoard> const &seeds);
+
+public:
+    explicit MagicAttackTables();
+    MagicAttackTables(MagicAttackTables const &other);
+    MagicAttackTables(MagicAttackTables &&other) noexcept;
+    MagicAttackTables& operator=(MagicAttackTables const &other);
+    MagicAttackTables& operator=(MagicAttackTables &&other) noexcept;
+    ~MagicAttackTables() = default;
+
+    inline std::uint64_t getKnightAttacks(int squareIndex) const { return knightAttacks[squareIndex]; }
+    inline std::uint64_t getKingAttacks(int squareIndex) const { return kingAttacks[squareIndex]; }
+    inline std::uint64_t getPawnAttacks(int squareIndex, PieceDirection pieceDirection) const { return pawnAttacks[static_cast<int>(pieceDirection)][squareIndex]; }
+
+    inline std::uint64_t getRookAttacks(int squareIndex, std::uint64_t occupancy) const {
+        Magic const &magic = rookMagics[squareIndex];
+        return rookAttacks[magic.offset + static_cast<int>(((occupancy & magic.mask) * magic.magic) >> magic.shift)];
+    }
+    inline std::uint64_t getBishopAttacks(int squareIndex, std::uint64_t occupancy) const {
+        Magic const &magic = bishopMagics[squareIndex];
+        return bishopAttacks[magic.offset + static_cast<int>(((occupancy & magic.mask) * magic.magic) >> magic.shift)];
+    }
+
+    std::uint64_t getSliderLines(int squareIndex, std::uint64_t orthogonalSliders, std::uint64_t diagonalSliders) const;
+};
+
+
+#endif /* MagicAttackTables_h */
@@ -0,0 +1,15 @@
+// PositionState.cc
+
+#include "PositionState.h"
+
+#include <optional>
+
+#include "BoardSquare.h"
+#include "Constants.h"
+
+
+/*
+ * Basic ctor
+ */
+PositionState::PositionState(std::optional<BoardSquare> const &enPassantSquare, Team teamToMove, int halfmoveClock) :
+    enPassantSquare(enPassantSquare), teamToMove(teamToMove), halfmoveClock(halfmoveClock) { }
@@ -0,0 +1,31 @@
+// PositionState.h
+
+#ifndef PositionState_h
+#define PositionState_h
+
+#include <optional>
+
+#include "BoardSquare.h"
+#include "Constants.h"
+
+
+/**
+ * PositionState Struct
+ * The state of a ChessBoard position that is not visible from its squares, stored with the position instead of derived from its move history
+ * - Castling eligibility is not stored here, it is carried by the hasMoved bit of each King and Rook already on the squares
+ */
+struct PositionState final {
+    std::optional<BoardSquare> enPassantSquare;    // Square of the Piece that can currently be captured en passant
+    Team teamToMove;
+    int halfmoveClock;                              // Moves made since the last capture or Pawn move
+
+    explicit PositionState(std::optional<BoardSquare> const &enPassantSquare, Team teamToMove, int halfmoveClock);
+    PositionState(PositionState const &other) = default;
+    PositionState(PositionState &&other) noexcept = default;
+    PositionState& operator=(PositionState const &other) = default;
+    PositionState& operator=(PositionState &&other) noexcept = default;
+    ~PositionState() = default;
+};
+
+
+#endif /* PositionState_h */
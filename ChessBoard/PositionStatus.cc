@@ -0,0 +1,14 @@
+// PositionStatus.cc
+
+#include "PositionStatus.h"
+
+#include "Constants.h"
+
+
+/*
+ * Basic ctor
+ * The GameResult follows from whether the Team is in check and whether it has any legal moves
+ */
+PositionStatus::PositionStatus(bool isInCheck, int numLegalMoves) :
+    isInCheck(isInCheck), numLegalMoves(numLegalMoves),
+    gameResult(numLegalMoves > 0 ? GameResult::IN_PROGRESS : isInCheck ? GameResult::CHECKMATE : GameResult::STALEMATE) { }
@@ -0,0 +1,27 @@
+// PositionStatus.h
+
+#ifndef PositionStatus_h
+#define PositionStatus_h
+
+#include "Constants.h"
+
+
+/**
+ * PositionStatus Struct
+ * Everything the game layer needs to know about a Team's situation in a ChessBoard position, computed from a single legal move generation
+ */
+struct PositionStatus final {
+    bool isInCheck;
+    int numLegalMoves;
+    GameResult gameResult;          // CHECKMATE or STALEMATE if the Team has no legal moves, IN_PROGRESS otherwise
+
+    explicit PositionStatus(bool isInCheck, int numLegalMoves);
+    PositionStatus(PositionStatus const &other) = default;
+    PositionStatus(PositionStatus &&other) noexcept = default;
+    PositionStatus& operator=(PositionStatus const &other) = default;
+    PositionStatus& operator=(PositionStatus &&other) noexcept = default;
+    ~PositionStatus() = default;
+};
+
+
+#endif /* PositionStatus_h */
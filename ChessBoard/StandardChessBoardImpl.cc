@@ -0,0 +1,1054 @@
+// StandardChessBoardImpl.cc
+
+#include "StandardChessBoardImpl.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "BoardGeometry.h"
+#include "BoardMove.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ClassifiedMove.h"
+#include "Cloneable.h"
+#include "Constants.h"
+#include "MagicAttackTables.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+#include "MovePicker.h"
+#include "Piece.h"
+#include "PieceCode.h"
+#include "PieceData.h"
+#include "PieceFactory.h"
+#include "PieceInfo.h"
+#include "PositionState.h"
+#include "ZobristKeys.h"
+
+
+/*
+ * Static
+ *
+ * The PieceTypes a Pawn can promote to, in the order Pawn generates them
+ */
+std::array<PieceType, 4> const StandardChessBoardImpl::promotionPieceTypes = { PieceType::QUEEN, PieceType::ROOK, PieceType::KNIGHT, PieceType::BISHOP };
+
+/*
+ * Static
+ *
+ * True if the PieceData argument describes a Piece a StandardChessBoardImpl can hold (BASIC, facing NORTH or SOUTH), false otherwise
+ */
+bool StandardChessBoardImpl::isStandardPiece(PieceData const &pieceData) {
+    return
+        pieceData.pieceLevel == PieceLevel::BASIC &&
+        (pieceData.pieceDirection == PieceDirection::NORTH || pieceData.pieceDirection == PieceDirection::SOUTH);
+}
+
+/*
+ * Static
+ *
+ * Returns the squares argument with every square moved by the row and col direction arguments (at most 1 col)
+ * Squares that would leave the ChessBoard are dropped
+ */
+std::uint64_t StandardChessBoardImpl::shiftSquares(std::uint64_t squares, int rowDirection, int colDirection) {
+    static std::uint64_t const firstColSquares = 0x0101010101010101ULL;
+    static std::uint64_t const lastColSquares = 0x8080808080808080ULL;
+    if (colDirection < 0) {
+        squares &= ~firstColSquares;
+    } else if (colDirection > 0) {
+        squares &= ~lastColSquares;
+    }
+
+    int numSquares = rowDirection * numColsOnBoard + colDirection;
+    return numSquares >= 0
+        ? squares << numSquares
+        : squares >> -numSquares;
+}
+
+
+#pragma mark - ScopedBoardMove
+
+/*
+ * Basic ctor
+ * Predicates using the guard are logically const, the StandardChessBoardImpl is restored before the guard is destroyed
+ */
+StandardChessBoardImpl::ScopedBoardMove::ScopedBoardMove(StandardChessBoardImpl const &chessBoard, MoveCode moveCode) :
+    chessBoard(const_cast<StandardChessBoardImpl&>(chessBoard)), undoRecord(this->chessBoard.applyMove(moveCode)) { }
+
+/*
+ * Dtor
+ */
+StandardChessBoardImpl::ScopedBoardMove::~ScopedBoardMove() {
+    chessBoard.revertMove(undoRecord);
+}
+
+
+#pragma mark - Specific To StandardChessBoardImpl
+
+/*
+ * Basic ctor
+ */
+StandardChessBoardImpl::StandardChessBoardImpl(std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry,
+                                               std::shared_ptr<MagicAttackTables const> magicAttackTables) :
+    Cloneable<ChessBoard, StandardChessBoardImpl>(),
+    teamOccupancy{}, pieceTypeOccupancy{}, northOccupancy(0), unmovedOccupancy(0), positionState(std::nullopt, teamOne, 0),
+    zobristKeys(std::move(zobristKeys)), boardGeometry(std::move(boardGeometry)), magicAttackTables(std::move(magicAttackTables)), positionHash(0) {
+
+    squares.fill(EMPTY_PIECE_CODE);
+}
+
+/*
+ * Copy ctor
+ */
+StandardChessBoardImpl::StandardChessBoardImpl(StandardChessBoardImpl const &other) :
+    StandardChessBoardImpl(other, true) { }
+
+/*
+ * Copy ctor
+ * Copies the move history only if shouldCopyMoveHistory, otherwise the copy starts with nothing to undo or redo
+ */
+StandardChessBoardImpl::StandardChessBoardImpl(StandardChessBoardImpl const &other, bool shouldCopyMoveHistory) : Cloneable<ChessBoard, StandardChessBoardImpl>(other),
+    squares(other.squares), teamOccupancy(other.teamOccupancy), pieceTypeOccupancy(other.pieceTypeOccupancy),
+    northOccupancy(other.northOccupancy), unmovedOccupancy(other.unmovedOccupancy), positionState(other.positionState),
+    zobristKeys(other.zobristKeys), boardGeometry(other.boardGeometry), magicAttackTables(other.magicAttackTables), positionHash(other.positionHash) {
+
+    if (shouldCopyMoveHistory) {
+        undoRecords = other.undoRecords;
+        redoMoveCodes = other.redoMoveCodes;
+    }
+}
+
+/*
+ * Move ctor
+ */
+StandardChessBoardImpl::StandardChessBoardImpl(StandardChessBoardImpl &&other) noexcept : Cloneable<ChessBoard, StandardChessBoardImpl>(std::move(other)),
+    squares(other.squares), teamOccupancy(other.teamOccupancy), pieceTypeOccupancy(other.pieceTypeOccupancy),
+    northOccupancy(other.northOccupancy), unmovedOccupancy(other.unmovedOccupancy), positionState(std::move(other.positionState)),
+    undoRecords(std::move(other.undoRecords)), redoMoveCodes(std::move(other.redoMoveCodes)),
+    zobristKeys(std::move(other.zobristKeys)), boardGeometry(std::move(other.boardGeometry)), magicAttackTables(std::move(other.magicAttackTables)), positionHash(other.positionHash) { }
+
+/*
+ * Copy assignment
+ */
+StandardChessBoardImpl& StandardChessBoardImpl::operator=(StandardChessBoardImpl const &other) {
+    if (this != &other) {
+        ChessBoard::operator=(other);
+
+        // Copy squares
+        squares = other.squares;
+        teamOccupancy = other.teamOccupancy;
+        pieceTypeOccupancy = other.pieceTypeOccupancy;
+        northOccupancy = other.northOccupancy;
+        unmovedOccupancy = other.unmovedOccupancy;
+        positionState = other.positionState;
+
+        // Copy move history
+        undoRecords = other.undoRecords;
+        redoMoveCodes = other.redoMoveCodes;
+
+        zobristKeys = other.zobristKeys;
+        boardGeometry = other.boardGeometry;
+        magicAttackTables = other.magicAttackTables;
+        positionHash = other.positionHash;
+        arePieceSquaresValid = { false, false };
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+StandardChessBoardImpl& StandardChessBoardImpl::operator=(StandardChessBoardImpl &&other) noexcept {
+    if (this != &other) {
+        ChessBoard::operator=(std::move(other));
+
+        squares = other.squares;
+        teamOccupancy = other.teamOccupancy;
+        pieceTypeOccupancy = other.pieceTypeOccupancy;
+        northOccupancy = other.northOccupancy;
+        unmovedOccupancy = other.unmovedOccupancy;
+        positionState = std::move(other.positionState);
+        undoRecords = std::move(other.undoRecords);
+        redoMoveCodes = std::move(other.redoMoveCodes);
+        zobristKeys = std::move(other.zobristKeys);
+        boardGeometry = std::move(other.boardGeometry);
+        magicAttackTables = std::move(other.magicAttackTables);
+        positionHash = other.positionHash;
+        arePieceSquaresValid = { false, false };
+    }
+    return *this;
+}
+
+/*
+ * Returns the square index of the BoardSquare argument, which must be on the ChessBoard
+ */
+int StandardChessBoardImpl::getSquareIndex(BoardSquare const &boardSquare) const {
+    return boardSquare.boardRow * numColsOnBoard + boardSquare.boardCol;
+}
+
+/*
+ * Returns the BoardSquare at the square index argument
+ */
+BoardSquare StandardChessBoardImpl::getBoardSquare(int squareIndex) const {
+    return BoardSquare(squareIndex / numColsOnBoard, squareIndex % numColsOnBoard);
+}
+
+/*
+ * Returns the PieceCode at the BoardSquare argument
+ * - OFF_BOARD_PIECE_CODE if BoardSquare argument is not on the ChessBoard
+ */
+PieceCode StandardChessBoardImpl::getPieceCodeAt(BoardSquare const &boardSquare) const {
+    return isSquareOnBoard(boardSquare)
+        ? squares[getSquareIndex(boardSquare)]
+        : OFF_BOARD_PIECE_CODE;
+}
+
+/*
+ * Returns the index of the Team argument into the per Team bitboards
+ */
+int StandardChessBoardImpl::getTeamIndex(Team team) const {
+    return team == teamOne
+        ? 0
+        : 1;
+}
+
+/*
+ * Returns team opposite to team argument
+ */
+Team StandardChessBoardImpl::getOtherTeam(Team team) const {
+    return team == teamOne
+        ? teamTwo
+        : teamOne;
+}
+
+/*
+ * Write the PieceCode argument to the square at the square index argument, keeping the bitboards and position hash in sync
+ */
+void StandardChessBoardImpl::setPieceCodeAt(int squareIndex, PieceCode newPieceCode) {
+    PieceCode &pieceCode = squares[squareIndex];
+    int boardRow = squareIndex / numColsOnBoard;
+    int boardCol = squareIndex % numColsOnBoard;
+    positionHash ^= zobristKeys->getPieceKey(boardRow, boardCol, pieceCode) ^ zobristKeys->getPieceKey(boardRow, boardCol, newPieceCode);
+
+    std::uint64_t square = std::uint64_t(1) << squareIndex;
+    if (PieceCodeUtilities::isPiece(pieceCode)) {
+        teamOccupancy[getTeamIndex(PieceCodeUtilities::getTeam(pieceCode))] &= ~square;
+        pieceTypeOccupancy[static_cast<int>(PieceCodeUtilities::getPieceType(pieceCode))] &= ~square;
+        northOccupancy &= ~square;
+        unmovedOccupancy &= ~square;
+    }
+    if (PieceCodeUtilities::isPiece(newPieceCode)) {
+        teamOccupancy[getTeamIndex(PieceCodeUtilities::getTeam(newPieceCode))] |= square;
+        pieceTypeOccupancy[static_cast<int>(PieceCodeUtilities::getPieceType(newPieceCode))] |= square;
+        if (PieceCodeUtilities::getPieceDirection(newPieceCode) == PieceDirection::NORTH) {
+            northOccupancy |= square;
+        }
+        if (!PieceCodeUtilities::getHasMoved(newPieceCode)) {
+            unmovedOccupancy |= square;
+        }
+    }
+    pieceCode = newPieceCode;
+    arePieceSquaresValid = { false, false };
+}
+
+/*
+ * Set the square of the Piece that can currently be captured en passant, keeping the position hash in sync
+ */
+void StandardChessBoardImpl::setEnPassantSquare(std::optional<BoardSquare> const &newEnPassantSquare) {
+    std::optional<BoardSquare> &enPassantSquare = positionState.enPassantSquare;
+    if (enPassantSquare.has_value()) {
+        positionHash ^= zobristKeys->getEnPassantKey(enPassantSquare.value().boardRow, enPassantSquare.value().boardCol);
+    }
+    if (newEnPassantSquare.has_value()) {
+        positionHash ^= zobristKeys->getEnPassantKey(newEnPassantSquare.value().boardRow, newEnPassantSquare.value().boardCol);
+    }
+    enPassantSquare = newEnPassantSquare;
+}
+
+/*
+ * Apply the move represented by the MoveCode argument by writing its squares directly, and advance the PositionState past it
+ * Returns the UndoRecord that reverts it, without touching the undo and redo stacks
+ */
+StandardChessBoardImpl::UndoRecord StandardChessBoardImpl::applyMove(MoveCode moveCode) {
+    int fromSquareIndex = MoveCodeUtilities::getFromSquareIndex(moveCode);
+    int toSquareIndex = MoveCodeUtilities::getToSquareIndex(moveCode);
+    int captureSquareIndex = getSquareIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard));
+    std::optional<BoardSquare> const &enPassantSquare = positionState.enPassantSquare;
+
+    UndoRecord undoRecord = {
+        moveCode, squares[fromSquareIndex], squares[captureSquareIndex], squares[toSquareIndex], EMPTY_PIECE_CODE,
+        enPassantSquare.has_value() ? getSquareIndex(enPassantSquare.value()) : -1, positionState.teamToMove, positionState.halfmoveClock, positionHash
+    };
+
+    // Move the Piece, promoting it if needed
+    PieceCode movedPieceCode = PieceCodeUtilities::withHasMoved(undoRecord.movedPieceCode, true);
+    if (MoveCodeUtilities::isPromotion(moveCode)) {
+        movedPieceCode = PieceCodeUtilities::withPieceType(movedPieceCode, MoveCodeUtilities::getPromotionPieceType(moveCode).value());
+    }
+    setPieceCodeAt(captureSquareIndex, EMPTY_PIECE_CODE);
+    setPieceCodeAt(toSquareIndex, movedPieceCode);
+    setPieceCodeAt(fromSquareIndex, EMPTY_PIECE_CODE);
+
+    // Move the Rook of a castle
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        int rookFromSquareIndex = getSquareIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard));
+        int rookToSquareIndex = getSquareIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard));
+        undoRecord.castledRookPieceCode = squares[rookFromSquareIndex];
+        setPieceCodeAt(rookToSquareIndex, PieceCodeUtilities::withHasMoved(undoRecord.castledRookPieceCode, true));
+        setPieceCodeAt(rookFromSquareIndex, EMPTY_PIECE_CODE);
+    }
+
+    // Advance the PositionState
+    bool doesResetHalfmoveClock =
+        PieceCodeUtilities::getPieceType(undoRecord.movedPieceCode) == PieceType::PAWN ||
+        PieceCodeUtilities::isPiece(undoRecord.capturedPieceCode);
+    setEnPassantSquare(MoveCodeUtilities::getDoesEnableEnpassant(moveCode) ? std::make_optional<BoardSquare>(getBoardSquare(toSquareIndex)) : std::nullopt);
+    setTeamToMove(getOtherTeam(PieceCodeUtilities::getTeam(undoRecord.movedPieceCode)));
+    positionState.halfmoveClock = doesResetHalfmoveClock ? 0 : positionState.halfmoveClock + 1;
+    return undoRecord;
+}
+
+/*
+ * Revert the move recorded by the UndoRecord argument, which must be the last move applied
+ * The prior PositionState and position hash are written back directly
+ */
+void StandardChessBoardImpl::revertMove(UndoRecord const &undoRecord) {
+    MoveCode moveCode = undoRecord.moveCode;
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        setPieceCodeAt(getSquareIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard)), EMPTY_PIECE_CODE);
+        setPieceCodeAt(getSquareIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard)), undoRecord.castledRookPieceCode);
+    }
+    setPieceCodeAt(MoveCodeUtilities::getToSquareIndex(moveCode), undoRecord.replacedPieceCode);
+    setPieceCodeAt(getSquareIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard)), undoRecord.capturedPieceCode);
+    setPieceCodeAt(MoveCodeUtilities::getFromSquareIndex(moveCode), undoRecord.movedPieceCode);
+
+    positionState.enPassantSquare = undoRecord.enPassantSquareIndex >= 0
+        ? std::make_optional<BoardSquare>(getBoardSquare(undoRecord.enPassantSquareIndex))
+        : std::nullopt;
+    positionState.teamToMove = undoRecord.teamToMove;
+    positionState.halfmoveClock = undoRecord.halfmoveClock;
+    positionHash = undoRecord.positionHash;
+}
+
+/*
+ * Clears the recorded redo moves
+ */
+void StandardChessBoardImpl::clearRedoMoves() {
+    redoMoveCodes.clear();
+}
+
+
+/*
+ * Appends a standard move from the square index argument to every square of the targets argument to the MoveList argument
+ */
+void StandardChessBoardImpl::addTargetMoves(int fromSquareIndex, std::uint64_t targets, std::uint64_t otherTeamOccupancy, MoveList &moves) const {
+    for (; targets != 0; targets &= targets - 1) {
+        int toSquareIndex = __builtin_ctzll(targets);
+        moves.push_back(MoveCodeUtilities::createMoveCode(fromSquareIndex, toSquareIndex, MoveKind::STANDARD, false, std::nullopt, (otherTeamOccupancy >> toSquareIndex) & 1));
+    }
+}
+
+/*
+ * Appends the Pawn move represented by the arguments to the MoveList argument, or a variant per promotion PieceType if it reaches its last row
+ */
+void StandardChessBoardImpl::addPawnMoves(int fromSquareIndex, int toSquareIndex, PieceDirection pieceDirection, MoveKind moveKind, bool doesEnableEnpassant, bool isCapture, MoveList &moves) const {
+    int promotionRow = pieceDirection == PieceDirection::NORTH ? 0 : numRowsOnBoard - 1;
+    if (toSquareIndex / numColsOnBoard == promotionRow) {
+        for (PieceType promotionPieceType : promotionPieceTypes) {
+            moves.push_back(MoveCodeUtilities::createMoveCode(fromSquareIndex, toSquareIndex, moveKind, doesEnableEnpassant, promotionPieceType, isCapture));
+        }
+    } else {
+        moves.push_back(MoveCodeUtilities::createMoveCode(fromSquareIndex, toSquareIndex, moveKind, doesEnableEnpassant, std::nullopt, isCapture));
+    }
+}
+
+/*
+ * Appends the pushes and captures of every Pawn of the Team and PieceDirection arguments to the MoveList argument
+ * Each kind of move is found for all of the Pawns at once by shifting their squares, the from square is recovered from the shift
+ */
+void StandardChessBoardImpl::generatePawnMoves(Team team, PieceDirection pieceDirection, MoveList &moves) const {
+    std::uint64_t directionOccupancy = pieceDirection == PieceDirection::NORTH ? northOccupancy : ~northOccupancy;
+    std::uint64_t pawns = teamOccupancy[getTeamIndex(team)] & pieceTypeOccupancy[static_cast<int>(PieceType::PAWN)] & directionOccupancy;
+    if (pawns == 0) {
+        return;
+    }
+
+    int rowDirection = pieceDirection == PieceDirection::NORTH ? -1 : 1;
+    int pushOffset = rowDirection * numColsOnBoard;
+    std::uint64_t otherTeamOccupancy = teamOccupancy[1 - getTeamIndex(team)];
+    std::uint64_t emptySquares = ~(teamOccupancy[0] | teamOccupancy[1]);
+
+    // Single and double (unmoved) pushes, each step onto an empty square
+    for (std::uint64_t singlePushes = shiftSquares(pawns, rowDirection, 0) & emptySquares; singlePushes != 0; singlePushes &= singlePushes - 1) {
+        int toSquareIndex = __builtin_ctzll(singlePushes);
+        addPawnMoves(toSquareIndex - pushOffset, toSquareIndex, pieceDirection, MoveKind::STANDARD, false, false, moves);
+    }
+    std::uint64_t doublePushes = shiftSquares(shiftSquares(pawns & unmovedOccupancy, rowDirection, 0) & emptySquares, rowDirection, 0) & emptySquares;
+    for (; doublePushes != 0; doublePushes &= doublePushes - 1) {
+        int toSquareIndex = __builtin_ctzll(doublePushes);
+        addPawnMoves(toSquareIndex - 2 * pushOffset, toSquareIndex, pieceDirection, MoveKind::STANDARD, true, false, moves);
+    }
+
+    // Captures onto an occupied square of the other Team
+    for (int colDirection : { -1, 1 }) {
+        for (std::uint64_t captures = shiftSquares(pawns, rowDirection, colDirection) & otherTeamOccupancy; captures != 0; captures &= captures - 1) {
+            int toSquareIndex = __builtin_ctzll(captures);
+            addPawnMoves(toSquareIndex - pushOffset - colDirection, toSquareIndex, pieceDirection, MoveKind::STANDARD, false, true, moves);
+        }
+    }
+}
+
+/*
+ * Appends the en passant captures of the Team argument to the MoveList argument, following the rules of Pawn
+ * Pawns beside the en passant square in its row capture it, moving forward into its col
+ */
+void StandardChessBoardImpl::generateEnPassantMoves(Team team, MoveList &moves) const {
+    if (!positionState.enPassantSquare.has_value() || !isSquareOtherTeam(positionState.enPassantSquare.value(), team)) {
+        return;
+    }
+
+    BoardSquare const &enPassantSquare = positionState.enPassantSquare.value();
+    for (int colDirection : { -1, 1 }) {
+        BoardSquare fromSquare(enPassantSquare.boardRow, enPassantSquare.boardCol + colDirection);
+        PieceCode pieceCode = getPieceCodeAt(fromSquare);
+        if (!PieceCodeUtilities::isPieceOf(pieceCode, team, PieceType::PAWN)) {
+            continue;
+        }
+
+        PieceDirection pieceDirection = PieceCodeUtilities::getPieceDirection(pieceCode);
+        BoardSquare toSquare(fromSquare.boardRow + (pieceDirection == PieceDirection::NORTH ? -1 : 1), enPassantSquare.boardCol);
+        if (isSquareOnBoard(toSquare)) {
+            addPawnMoves(getSquareIndex(fromSquare), getSquareIndex(toSquare), pieceDirection, MoveKind::EN_PASSANT_SAME_ROW, false, true, moves);
+        }
+    }
+}
+
+/*
+ * Appends the castles of the unmoved King at the square index argument to the MoveList argument, following the rules of King
+ * The King must stand on the first or last row and not be attacked, and the Rook must be unmoved and face the same PieceDirection
+ * The squares the King and Rook land on must be empty, the Rook's not attacked, and the square beside a far Rook empty too
+ */
+void StandardChessBoardImpl::generateCastleMoves(int kingSquareIndex, MoveList &moves) const {
+    PieceCode kingPieceCode = squares[kingSquareIndex];
+    Team team = PieceCodeUtilities::getTeam(kingPieceCode);
+    int kingRow = kingSquareIndex / numColsOnBoard;
+    int kingCol = kingSquareIndex % numColsOnBoard;
+    if ((kingRow != 0 && kingRow != numRowsOnBoard - 1) || isSquareAttacked(getBoardSquare(kingSquareIndex), team)) {
+        return;
+    }
+
+    auto addCastleMove = [&](int colDirection, int rookDistance) {
+        int rookFromSquareIndex = kingSquareIndex + colDirection * rookDistance;
+        int toSquareIndex = kingSquareIndex + colDirection * 2;
+        int rookToSquareIndex = kingSquareIndex + colDirection;
+        PieceCode rookPieceCode = squares[rookFromSquareIndex];
+        if (PieceCodeUtilities::isPieceOf(rookPieceCode, team, PieceType::ROOK) &&
+            PieceCodeUtilities::getPieceDirection(rookPieceCode) == PieceCodeUtilities::getPieceDirection(kingPieceCode) &&
+            !PieceCodeUtilities::getHasMoved(rookPieceCode) &&
+            squares[toSquareIndex] == EMPTY_PIECE_CODE &&
+            squares[rookToSquareIndex] == EMPTY_PIECE_CODE && !isSquareAttacked(getBoardSquare(rookToSquareIndex), team)) {
+
+            moves.push_back(MoveCodeUtilities::createMoveCode(kingSquareIndex, toSquareIndex, MoveKind::CASTLE, false, std::nullopt, false));
+        }
+    };
+
+    // Left Castle: Check if have enough room to the left and that the rook travel square is empty
+    if (kingCol >= 4 && squares[kingSquareIndex - 3] == EMPTY_PIECE_CODE) {
+        addCastleMove(-1, 4);
+    }
+
+    // Right Castle: Check if have enough room to the right
+    if (kingCol <= numColsOnBoard - 4) {
+        addCastleMove(1, 3);
+    }
+}
+
+/*
+ * Appends all pseudo legal moves originating from the BoardSquare argument to the MoveList argument
+ * A single Piece is generated through its Piece, which queries the StandardChessBoardImpl square by square
+ */
+void StandardChessBoardImpl::generateAllPseudoLegalMovesAtSquare(BoardSquare const &boardSquare, MoveList &moves) const {
+    if (isSquareOnBoard(boardSquare) && !isSquareEmpty(boardSquare)) {
+        PieceFactory::getPiece(getPieceCodeAt(boardSquare)).addMoves(*this, boardSquare, false, moves);
+    }
+}
+
+/*
+ * True if the square index argument is attacked by any of the attacking Pieces argument, with the occupied squares argument blocking sliders
+ * The arguments need not match the StandardChessBoardImpl, so that a move can be tested without making it
+ */
+bool StandardChessBoardImpl::isSquareIndexAttacked(int squareIndex, std::uint64_t occupancy, std::uint64_t attackingPieces) const {
+    MagicAttackTables const &tables = *magicAttackTables;
+    std::uint64_t pawns = pieceTypeOccupancy[static_cast<int>(PieceType::PAWN)] & attackingPieces;
+    std::uint64_t queens = pieceTypeOccupancy[static_cast<int>(PieceType::QUEEN)] & attackingPieces;
+
+    // Pawns attack a square from where a Pawn of the opposite PieceDirection on it would attack
+    return
+        (tables.getPawnAttacks(squareIndex, PieceDirection::SOUTH) & pawns & northOccupancy) ||
+        (tables.getPawnAttacks(squareIndex, PieceDirection::NORTH) & pawns & ~northOccupancy) ||
+        (tables.getKnightAttacks(squareIndex) & pieceTypeOccupancy[static_cast<int>(PieceType::KNIGHT)] & attackingPieces) ||
+        (tables.getKingAttacks(squareIndex) & pieceTypeOccupancy[static_cast<int>(PieceType::KING)] & attackingPieces) ||
+        (tables.getRookAttacks(squareIndex, occupancy) & ((pieceTypeOccupancy[static_cast<int>(PieceType::ROOK)] & attackingPieces) | queens)) ||
+        (tables.getBishopAttacks(squareIndex, occupancy) & ((pieceTypeOccupancy[static_cast<int>(PieceType::BISHOP)] & attackingPieces) | queens));
+}
+
+/*
+ * True if the pseudo legal move represented by the MoveCode argument does not leave a King of the Team argument attacked, false otherwise
+ * The occupied squares and the attacking Pieces are adjusted for the move, and every King of the Team is tested against them
+ */
+bool StandardChessBoardImpl::isPseudoLegalMoveLegal(MoveCode moveCode, Team team) const {
+    int teamIndex = getTeamIndex(team);
+    int fromSquareIndex = MoveCodeUtilities::getFromSquareIndex(moveCode);
+    int toSquareIndex = MoveCodeUtilities::getToSquareIndex(moveCode);
+    int captureSquareIndex = getSquareIndex(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard));
+    std::uint64_t fromSquare = std::uint64_t(1) << fromSquareIndex;
+    std::uint64_t toSquare = std::uint64_t(1) << toSquareIndex;
+    std::uint64_t captureSquare = std::uint64_t(1) << captureSquareIndex;
+
+    std::uint64_t occupancy = ((teamOccupancy[0] | teamOccupancy[1]) & ~fromSquare & ~captureSquare) | toSquare;
+    if (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::CASTLE) {
+        occupancy &= ~(std::uint64_t(1) << getSquareIndex(MoveCodeUtilities::getCastleRookFromSquare(moveCode, numColsOnBoard)));
+        occupancy |= std::uint64_t(1) << getSquareIndex(MoveCodeUtilities::getCastleRookToSquare(moveCode, numColsOnBoard));
+    }
+    std::uint64_t attackingPieces = teamOccupancy[1 - teamIndex] & ~captureSquare & ~toSquare;     // The to square's occupant differs from the captured Piece for en passant onto an occupied square
+
+    std::uint64_t kings = teamOccupancy[teamIndex] & pieceTypeOccupancy[static_cast<int>(PieceType::KING)];
+    if (kings & fromSquare) {
+        kings = (kings & ~fromSquare) | toSquare;
+    }
+    for (; kings != 0; kings &= kings - 1) {
+        if (isSquareIndexAttacked(__builtin_ctzll(kings), occupancy, attackingPieces)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Removes the illegal moves from the MoveList argument in place, keeping the order of the legal ones
+ * Only moves from firstMoveIndex onward are filtered, and they must all be pseudo legal moves of the Team argument
+ * While the Team is not in check, a standard move of a Piece other than a King that does not start on a ray from one of its Kings
+ * towards a slider of the other Team cannot expose a King, so it is legal without testing the Kings
+ */
+void StandardChessBoardImpl::filterLegalMoves(MoveList &moves, int firstMoveIndex, Team team) const {
+    int teamIndex = getTeamIndex(team);
+    std::uint64_t kings = teamOccupancy[teamIndex] & pieceTypeOccupancy[static_cast<int>(PieceType::KING)];
+    std::uint64_t kingLines = ~std::uint64_t(0);
+    if (!isInCheck(team)) {
+        std::uint64_t otherTeamOccupancy = teamOccupancy[1 - teamIndex];
+        std::uint64_t queens = pieceTypeOccupancy[static_cast<int>(PieceType::QUEEN)] & otherTeamOccupancy;
+        std::uint64_t orthogonalSliders = (pieceTypeOccupancy[static_cast<int>(PieceType::ROOK)] & otherTeamOccupancy) | queens;
+        std::uint64_t diagonalSliders = (pieceTypeOccupancy[static_cast<int>(PieceType::BISHOP)] & otherTeamOccupancy) | queens;
+        kingLines = kings;
+        for (std::uint64_t remainingKings = kings; remainingKings != 0; remainingKings &= remainingKings - 1) {
+            kingLines |= magicAttackTables->getSliderLines(__builtin_ctzll(remainingKings), orthogonalSliders, diagonalSliders);
+        }
+    }
+
+    int numLegalMoves = firstMoveIndex;
+    for (int moveIndex = firstMoveIndex; moveIndex < moves.size(); ++moveIndex) {
+        MoveCode moveCode = moves[moveIndex];
+        bool isMoveLegal =
+            (MoveCodeUtilities::getMoveKind(moveCode) == MoveKind::STANDARD && !((kingLines >> MoveCodeUtilities::getFromSquareIndex(moveCode)) & 1)) ||
+            isPseudoLegalMoveLegal(moveCode, team);
+        if (isMoveLegal) {
+            moves[numLegalMoves++] = moveCode;
+        }
+    }
+    moves.truncate(numLegalMoves);
+}
+
+/*
+ * Rebuilds the piece lists of the Team argument from its bitboards, in square index order
+ */
+void StandardChessBoardImpl::refreshPieceSquares(Team team) const {
+    int teamIndex = getTeamIndex(team);
+    pieceSquares[teamIndex].clear();
+    kingSquares[teamIndex].clear();
+    for (std::uint64_t pieces = teamOccupancy[teamIndex]; pieces != 0; pieces &= pieces - 1) {
+        int squareIndex = __builtin_ctzll(pieces);
+        pieceSquares[teamIndex].emplace_back(getBoardSquare(squareIndex));
+        if ((pieceTypeOccupancy[static_cast<int>(PieceType::KING)] >> squareIndex) & 1) {
+            kingSquares[teamIndex].emplace_back(getBoardSquare(squareIndex));
+        }
+    }
+    arePieceSquaresValid[teamIndex] = true;
+}
+
+/*
+ * True if Team argument has a legal move available to make, false otherwise
+ */
+bool StandardChessBoardImpl::canMakeMove(Team team) const {
+    MovePicker movePicker(*this, team);
+    return movePicker.next().has_value();
+}
+
+/*
+ * True if BoardMove argument would apply check after being made, false otherwise
+ */
+bool StandardChessBoardImpl::doesMoveApplyCheck(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team otherTeam = getOtherTeam(getPieceDataAt(boardMove->getFromSquare()).value().team);
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
+
+    return isInCheck(otherTeam);
+}
+
+/*
+ * True if BoardMove argument would capture a piece after being made, false otherwise
+ */
+bool StandardChessBoardImpl::doesMoveCapturePiece(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
+    std::optional<PieceData> attackedPieceData = getPieceDataAt(boardMove->getCaptureSquare());
+
+    return attackedPieceData.has_value() && attackedPieceData.value().team != movedPieceTeam;
+}
+
+/*
+ * True if BoardMove argument would leave a piece on it's own team attacked after being made, false otherwise
+ */
+bool StandardChessBoardImpl::doesMoveLeavePieceAttacked(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
+
+    MoveList replyMoves;
+    generateAllLegalMoves(getOtherTeam(movedPieceTeam), replyMoves);
+    return std::any_of(replyMoves.begin(), replyMoves.end(), [](MoveCode replyMove) { return MoveCodeUtilities::isCapture(replyMove); });
+}
+
+/*
+ * True if BoardMove argument would win the game after being made, false otherwise
+ */
+bool StandardChessBoardImpl::doesMoveWinGame(std::unique_ptr<BoardMove> const &boardMove) const {
+    Team movedPieceTeam = getPieceDataAt(boardMove->getFromSquare()).value().team;
+    ScopedBoardMove scopedBoardMove(*this, MoveCodeUtilities::encode(*boardMove, *this));
+
+    return isInCheckMate(getOtherTeam(movedPieceTeam));
+}
+
+
+#pragma mark - ChessBoard Interface Implementation
+
+/*
+ * Create PieceData Optional
+ * - value if Piece exists at BoardSquare argument
+ * - nullopt otherwise
+ */
+std::optional<PieceData> StandardChessBoardImpl::getPieceDataAtImpl(BoardSquare const &boardSquare) const {
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode)
+        ? std::make_optional<PieceData>(PieceCodeUtilities::decode(pieceCode))
+        : std::nullopt;
+}
+
+/*
+ * Create PieceInfo Optional
+ * - value if Piece exists at BoardSquare argument
+ * - nullopt otherwise
+ */
+std::optional<PieceInfo> StandardChessBoardImpl::getPieceInfoAtImpl(BoardSquare const &boardSquare) const {
+    PieceCode pieceCode = getPieceCodeAt(boardSquare);
+    return PieceCodeUtilities::isPiece(pieceCode)
+        ? std::make_optional<PieceInfo>(PieceFactory::getPiece(pieceCode).getPieceInfo())
+        : std::nullopt;
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard, false otherwise
+ */
+bool StandardChessBoardImpl::isSquareOnBoardImpl(BoardSquare const &boardSquare) const {
+    return
+        static_cast<unsigned int>(boardSquare.boardRow) < static_cast<unsigned int>(numRowsOnBoard) &&
+        static_cast<unsigned int>(boardSquare.boardCol) < static_cast<unsigned int>(numColsOnBoard);
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and there is no Piece at that location, false otherwise
+ */
+bool StandardChessBoardImpl::isSquareEmptyImpl(BoardSquare const &boardSquare) const {
+    return getPieceCodeAt(boardSquare) == EMPTY_PIECE_CODE;
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and the Team of The Piece at that location is equal to the Team argument, false otherwise
+ */
+bool StandardChessBoardImpl::isSquareSameTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const {
+    return isSquareOnBoard(boardSquare) && ((teamOccupancy[getTeamIndex(ownTeam)] >> getSquareIndex(boardSquare)) & 1);
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and the Team of The Piece at that location is not equal to the Team argument, false otherwise
+ */
+bool StandardChessBoardImpl::isSquareOtherTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const {
+    return isSquareOnBoard(boardSquare) && ((teamOccupancy[getTeamIndex(getOtherTeam(ownTeam))] >> getSquareIndex(boardSquare)) & 1);
+}
+
+/*
+ * True if BoardSquare argument is a valid BoardSquare on the ChessBoard and that location is attacked by the Team opposite to the Team argument, false otherwise
+ */
+bool StandardChessBoardImpl::isSquareAttackedImpl(BoardSquare const &boardSquare, Team ownTeam) const {
+    return
+        isSquareOnBoard(boardSquare) &&
+        isSquareIndexAttacked(getSquareIndex(boardSquare), teamOccupancy[0] | teamOccupancy[1], teamOccupancy[getTeamIndex(getOtherTeam(ownTeam))]);
+}
+
+/*
+ * True if Team argument is in check, false otherwise
+ */
+bool StandardChessBoardImpl::isInCheckImpl(Team team) const {
+    int teamIndex = getTeamIndex(team);
+    std::uint64_t occupancy = teamOccupancy[0] | teamOccupancy[1];
+    for (std::uint64_t kings = teamOccupancy[teamIndex] & pieceTypeOccupancy[static_cast<int>(PieceType::KING)]; kings != 0; kings &= kings - 1) {
+        if (isSquareIndexAttacked(__builtin_ctzll(kings), occupancy, teamOccupancy[1 - teamIndex])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * True if Team argument is in checkmate, false otherwise
+ */
+bool StandardChessBoardImpl::isInCheckMateImpl(Team team) const {
+    return isInCheck(team) && !canMakeMove(team);
+}
+
+/*
+ * True if Team argument is in stalemate, false otherwise
+ */
+bool StandardChessBoardImpl::isInStaleMateImpl(Team team) const {
+    return !isInCheck(team) && !canMakeMove(team);
+}
+
+/*
+ * Appends all legal moves originating from the BoardSquare argument to the MoveList argument
+ */
+void StandardChessBoardImpl::generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const {
+    int firstMoveIndex = moves.size();
+    generateAllPseudoLegalMovesAtSquare(boardSquare, moves);
+    if (moves.size() > firstMoveIndex) {
+        filterLegalMoves(moves, firstMoveIndex, PieceCodeUtilities::getTeam(getPieceCodeAt(boardSquare)));
+    }
+}
+
+/*
+ * Appends all legal moves that can be made by the Team argument to the MoveList argument
+ */
+void StandardChessBoardImpl::generateAllLegalMovesImpl(Team team, MoveList &moves) const {
+    int firstMoveIndex = moves.size();
+    generateAllPseudoLegalMoves(team, moves);
+    filterLegalMoves(moves, firstMoveIndex, team);
+}
+
+/*
+ * Appends all pseudo legal moves that can be made by the Team argument to the MoveList argument
+ * - Pawns a PieceDirection at a time, then en passant captures
+ * - Knights, Bishops, Rooks, Queens and Kings a Piece at a time, from their attacked squares less those of their own Team, then castles
+ */
+void StandardChessBoardImpl::generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const {
+    MagicAttackTables const &tables = *magicAttackTables;
+    int teamIndex = getTeamIndex(team);
+    std::uint64_t ownOccupancy = teamOccupancy[teamIndex];
+    std::uint64_t otherTeamOccupancy = teamOccupancy[1 - teamIndex];
+    std::uint64_t occupancy = ownOccupancy | otherTeamOccupancy;
+
+    // Pawns
+    generatePawnMoves(team, PieceDirection::NORTH, moves);
+    generatePawnMoves(team, PieceDirection::SOUTH, moves);
+    generateEnPassantMoves(team, moves);
+
+    // Knights
+    for (std::uint64_t knights = ownOccupancy & pieceTypeOccupancy[static_cast<int>(PieceType::KNIGHT)]; knights != 0; knights &= knights - 1) {
+        int fromSquareIndex = __builtin_ctzll(knights);
+        addTargetMoves(fromSquareIndex, tables.getKnightAttacks(fromSquareIndex) & ~ownOccupancy, otherTeamOccupancy, moves);
+    }
+
+    // Bishops, Rooks, Queens
+    std::uint64_t queens = ownOccupancy & pieceTypeOccupancy[static_cast<int>(PieceType::QUEEN)];
+    for (std::uint64_t diagonalSliders = (ownOccupancy & pieceTypeOccupancy[static_cast<int>(PieceType::BISHOP)]) | queens; diagonalSliders != 0; diagonalSliders &= diagonalSliders - 1) {
+        int fromSquareIndex = __builtin_ctzll(diagonalSliders);
+        addTargetMoves(fromSquareIndex, tables.getBishopAttacks(fromSquareIndex, occupancy) & ~ownOccupancy, otherTeamOccupancy, moves);
+    }
+    for (std::uint64_t orthogonalSliders = (ownOccupancy & pieceTypeOccupancy[static_cast<int>(PieceType::ROOK)]) | queens; orthogonalSliders != 0; orthogonalSliders &= orthogonalSliders - 1) {
+        int fromSquareIndex = __builtin_ctzll(orthogonalSliders);
+        addTargetMoves(fromSquareIndex, tables.getRookAttacks(fromSquareIndex, occupancy) & ~ownOccupancy, otherTeamOccupancy, moves);
+    }
+
+    // Kings
+    for (std::uint64_t kings = ownOccupancy & pieceTypeOccupancy[static_cast<int>(PieceType::KING)]; kings != 0; kings &= kings - 1) {
+        int fromSquareIndex = __builtin_ctzll(kings);
+        addTargetMoves(fromSquareIndex, tables.getKingAttacks(fromSquareIndex) & ~ownOccupancy, otherTeamOccupancy, moves);
+        if ((unmovedOccupancy >> fromSquareIndex) & 1) {
+            generateCastleMoves(fromSquareIndex, moves);
+        }
+    }
+}
+
+/*
+ * True if the pseudo legal move represented by the MoveCode argument does not leave its own King attacked, false otherwise
+ */
+bool StandardChessBoardImpl::isPseudoLegalMoveLegalImpl(MoveCode moveCode) const {
+    return isPseudoLegalMoveLegal(moveCode, PieceCodeUtilities::getTeam(squares[MoveCodeUtilities::getFromSquareIndex(moveCode)]));
+}
+
+/*
+ * Generate all legal moves that apply check that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> StandardChessBoardImpl::generateCheckApplyingMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> checkApplyingBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (doesMoveApplyCheck(legalBoardMove)) {
+            checkApplyingBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return checkApplyingBoardMoves;
+}
+
+/*
+ * Generate all legal moves that capture a Piece that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> StandardChessBoardImpl::generateCapturingMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> capturingBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (doesMoveCapturePiece(legalBoardMove)) {
+            capturingBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return capturingBoardMoves;
+}
+
+/*
+ * Generate all legal moves that don't leave a Piece of it's own Team in a position to be captured that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> StandardChessBoardImpl::generateCaptureAvoidingMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> captureAvoidingBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (!doesMoveLeavePieceAttacked(legalBoardMove)) {
+            captureAvoidingBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return captureAvoidingBoardMoves;
+}
+
+/*
+ * Generate all legal moves that win the game that can be made by the Team argument
+ */
+std::vector<std::unique_ptr<BoardMove>> StandardChessBoardImpl::generateWinningMovesImpl(Team team) const {
+    std::vector<std::unique_ptr<BoardMove>> winningBoardMoves;
+    std::vector<std::unique_ptr<BoardMove>> legalBoardMoves = generateAllLegalMoves(team);
+    for (std::unique_ptr<BoardMove> &legalBoardMove : legalBoardMoves) {
+        if (doesMoveWinGame(legalBoardMove)) {
+            winningBoardMoves.emplace_back(std::move(legalBoardMove));
+        }
+    }
+    return winningBoardMoves;
+}
+
+/*
+ * Generate all legal moves that can be made by the Team argument, each tagged with the MoveFlags that describe it
+ * Every move is made in place once, and the other Team's legal replies are generated once, to decide all of its MoveFlags
+ */
+std::vector<ClassifiedMove> StandardChessBoardImpl::generateClassifiedMovesImpl(Team team) const {
+    std::vector<ClassifiedMove> classifiedMoves;
+    Team otherTeam = getOtherTeam(team);
+
+    MoveList legalMoves;
+    generateAllLegalMoves(team, legalMoves);
+    classifiedMoves.reserve(legalMoves.size());
+    for (MoveCode legalMove : legalMoves) {
+        MoveFlags moveFlags = MoveCodeUtilities::isCapture(legalMove) ? CAPTURES_PIECE_FLAG : NO_MOVE_FLAGS;
+        ScopedBoardMove scopedBoardMove(*this, legalMove);
+
+        MoveList replyMoves;
+        generateAllLegalMoves(otherTeam, replyMoves);
+        if (isInCheck(otherTeam)) {
+            moveFlags |= APPLIES_CHECK_FLAG;
+            if (replyMoves.empty()) {
+                moveFlags |= WINS_GAME_FLAG;
+            }
+        }
+        if (std::any_of(replyMoves.begin(), replyMoves.end(), [](MoveCode replyMove) { return MoveCodeUtilities::isCapture(replyMove); })) {
+            moveFlags |= LEAVES_PIECE_ATTACKED_FLAG;
+        }
+        classifiedMoves.emplace_back(legalMove, moveFlags);
+    }
+    return classifiedMoves;
+}
+
+/*
+ * Set the Piece at the BoardSquare argument location based on the PieceData argument, which must be a standard Piece
+ */
+void StandardChessBoardImpl::setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) {
+    assert(isStandardPiece(pieceData));
+    setPieceCodeAt(getSquareIndex(boardSquare), PieceCodeUtilities::encode(pieceData));
+}
+
+/*
+ * Clear the BoardSqure argument location of any Pieces
+ */
+void StandardChessBoardImpl::clearPositionImpl(BoardSquare const &boardSquare) {
+    setPieceCodeAt(getSquareIndex(boardSquare), EMPTY_PIECE_CODE);
+}
+
+/*
+ * Clear the entire ChessBoard of any pieces
+ */
+void StandardChessBoardImpl::clearBoardImpl() {
+    for (ChessBoard::BoardSquareIterator it = this->begin(); it != this->end(); ++it) {
+        clearPosition(*it);
+    }
+}
+
+/*
+ * Create BoardMove Optional
+ * - value if arguments match a legal BoardMove with the current ChessBoard state
+ * - nullopt otherwise
+ */
+std::optional<std::unique_ptr<BoardMove>> StandardChessBoardImpl::createBoardMoveImpl(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType) const {
+    if (!isSquareOnBoard(fromSquare)) {
+        return std::nullopt;
+    }
+
+    MoveList legalMoves;
+    generateAllLegalMovesAtSquare(fromSquare, legalMoves);
+    for (MoveCode legalMove : legalMoves) {
+        if (toSquare == MoveCodeUtilities::getToSquare(legalMove, numColsOnBoard) &&
+            promotionPieceType == MoveCodeUtilities::getPromotionPieceType(legalMove)) {
+
+            return MoveCodeUtilities::decode(legalMove, *this);
+        }
+    }
+    return std::nullopt;
+}
+
+/*
+ * True if the BoardMove argument is a legal move with the current ChessBoard state, false otherwise
+ */
+bool StandardChessBoardImpl::isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove) const {
+    if (isSquareOnBoard(boardMove->getFromSquare())) {
+        std::vector<std::unique_ptr<BoardMove>> pieceBoardMoves = generateAllLegalMovesAtSquare(boardMove->getFromSquare());
+        if (std::find_if(pieceBoardMoves.begin(), pieceBoardMoves.end(), [&boardMove](std::unique_ptr<BoardMove> const& pieceBoardMove) { return *pieceBoardMove == *boardMove; }) != pieceBoardMoves.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Apply the BoardMove argument to the ChessBoard
+ */
+void StandardChessBoardImpl::makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) {
+    makeMoveImpl(MoveCodeUtilities::encode(*boardMove, *this));
+}
+
+/*
+ * Apply the move represented by the MoveCode argument to the ChessBoard
+ */
+void StandardChessBoardImpl::makeMoveImpl(MoveCode moveCode) {
+    undoRecords.emplace_back(applyMove(moveCode));                                  // Apply the move and track it for undoing
+    clearRedoMoves();                                                               // Clear redo moves (can't redo after making a move)
+}
+
+/*
+ * Undo the last made move
+ * - True if move available to be undone
+ * - False otherwise (and BoardState remains unchanged)
+ */
+bool StandardChessBoardImpl::undoMoveImpl() {
+    if (undoRecords.empty()) {
+        return false;
+    } else {
+        UndoRecord const &lastUndoRecord = undoRecords.back();                      // Get the record of the last made move
+        revertMove(lastUndoRecord);                                                 // Undo the move
+        redoMoveCodes.emplace_back(lastUndoRecord.moveCode);                        // Push it to the redo moves stack
+        undoRecords.pop_back();                                                     // Pop it off the undo stack
+        return true;
+    }
+}
+
+/*
+ * Redo the last undone move
+ * - True if move available to be redone
+ * - False otherwise (and BoardState remains unchanged)
+ */
+bool StandardChessBoardImpl::redoMoveImpl() {
+    if (redoMoveCodes.empty()) {
+        return false;
+    } else {
+        MoveCode lastUndoneMoveCode = redoMoveCodes.back();                         // Get the last move to be undone
+        redoMoveCodes.pop_back();                                                   // Pop it off the redo moves stack
+        undoRecords.emplace_back(applyMove(lastUndoneMoveCode));                    // Apply the move and track it for undoing
+        return true;
+    }
+}
+
+/*
+ * Copy the position into a new ChessBoard, leaving the move history behind
+ */
+std::unique_ptr<ChessBoard> StandardChessBoardImpl::clonePositionImpl() const {
+    return std::unique_ptr<ChessBoard>(new StandardChessBoardImpl(*this, false));
+}
+
+/*
+ * Set the Team whose turn it is to move, keeping the position hash in sync
+ */
+void StandardChessBoardImpl::setTeamToMoveImpl(Team team) {
+    if (team != positionState.teamToMove) {
+        positionHash ^= zobristKeys->getSideToMoveKey();
+        positionState.teamToMove = team;
+    }
+}
+
+/*
+ * Returns the locations of every Piece of the Team argument, rebuilt from the bitboards if they changed since the last call
+ */
+std::vector<BoardSquare> const& StandardChessBoardImpl::getPieceSquaresImpl(Team team) const {
+    if (!arePieceSquaresValid[getTeamIndex(team)]) {
+        refreshPieceSquares(team);
+    }
+    return pieceSquares[getTeamIndex(team)];
+}
+
+/*
+ * Returns the locations of every King of the Team argument, rebuilt from the bitboards if they changed since the last call
+ */
+std::vector<BoardSquare> const& StandardChessBoardImpl::getKingSquaresImpl(Team team) const {
+    if (!arePieceSquaresValid[getTeamIndex(team)]) {
+        refreshPieceSquares(team);
+    }
+    return kingSquares[getTeamIndex(team)];
+}
+
+/* Getters */
+std::optional<BoardSquare> StandardChessBoardImpl::getEnPassantSquareImpl() const { return positionState.enPassantSquare; }
+int StandardChessBoardImpl::getHalfmoveClockImpl() const { return positionState.halfmoveClock; }
+std::uint64_t StandardChessBoardImpl::getPositionHashImpl() const { return positionHash; }
+BoardGeometry const& StandardChessBoardImpl::getBoardGeometryImpl() const { return *boardGeometry; }
+Team StandardChessBoardImpl::getTeamToMoveImpl() const { return positionState.teamToMove; }
+Team StandardChessBoardImpl::getTeamOneImpl() const { return teamOne; }
+Team StandardChessBoardImpl::getTeamTwoImpl() const { return teamTwo; }
+int StandardChessBoardImpl::getNumRowsOnBoardImpl() const { return numRowsOnBoard; }
+int StandardChessBoardImpl::getNumColsOnBoardImpl() const { return numColsOnBoard; }
+
+/* BoardSquareIterator */
+ChessBoard::BoardSquareIterator StandardChessBoardImpl::beginImpl() { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator StandardChessBoardImpl::beginImpl() const { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator StandardChessBoardImpl::cbeginImpl() const { return createBoardSquareIterator(0, 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator StandardChessBoardImpl::endImpl() { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator StandardChessBoardImpl::endImpl() const { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::BoardSquareIterator StandardChessBoardImpl::cendImpl() const { return createBoardSquareIterator(getNumRowsOnBoard(), 0, getNumRowsOnBoard(), getNumColsOnBoard()); }
+
+/* ReverseBoardSquareIterator */
+ChessBoard::ReverseBoardSquareIterator StandardChessBoardImpl::rbeginImpl() { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator StandardChessBoardImpl::rbeginImpl() const { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator StandardChessBoardImpl::crbeginImpl() const { return createReverseBoardSquareIterator(getNumRowsOnBoard() - 1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator StandardChessBoardImpl::rendImpl() { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator StandardChessBoardImpl::rendImpl() const { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
+ChessBoard::ReverseBoardSquareIterator StandardChessBoardImpl::crendImpl() const { return createReverseBoardSquareIterator(-1, getNumColsOnBoard() - 1, getNumRowsOnBoard(), getNumColsOnBoard()); }
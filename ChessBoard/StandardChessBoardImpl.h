@@ -0,0 +1,224 @@
+// StandardChessBoardImpl.h
+
+#ifndef StandardChessBoardImpl_h
+#define StandardChessBoardImpl_h
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "BoardGeometry.h"
+#include "BoardMove.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ClassifiedMove.h"
+#include "Cloneable.h"
+#include "Constants.h"
+#include "MagicAttackTables.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+#include "PieceCode.h"
+#include "PieceData.h"
+#include "PieceInfo.h"
+#include "PositionState.h"
+#include "ZobristKeys.h"
+
+
+/**
+ * StandardChessBoardImpl ChessBoard Class
+ * An 8x8 ChessBoard of BASIC Pieces facing NORTH or SOUTH, the setup of a standard game, kept as 64 bit bitboards
+ * - Occupancy per Team, per PieceType, of NORTH facing Pieces and of Pieces that have not moved, alongside a PieceCode per square
+ * - Pawn moves are generated for every Pawn of a PieceDirection at once by shifting and masking
+ * - Knight and King targets come from precomputed tables, slider targets from magic lookups in the shared MagicAttackTables
+ * - Legality is tested by attacking the King on the occupancy left by the move, without making it
+ * Placing any other Piece is a programming error, ChessBoardFactory wraps it in an AdaptiveChessBoardImpl that falls back to ChessBoardImpl instead
+ */
+class StandardChessBoardImpl final : public Cloneable<ChessBoard, StandardChessBoardImpl> {
+
+private:
+
+    /**
+     * UndoRecord Struct
+     * Everything needed to revert one move by direct writes, kept by value on the undo stack
+     */
+    struct UndoRecord final {
+        MoveCode moveCode;
+        PieceCode movedPieceCode;           // Moved Piece before the move, restores its hasMoved and pre promotion PieceType
+        PieceCode capturedPieceCode;        // EMPTY_PIECE_CODE if nothing was captured
+        PieceCode replacedPieceCode;        // Prior occupant of the to square, differs from capturedPieceCode only for en passant onto an occupied square
+        PieceCode castledRookPieceCode;     // Rook before the move if moveCode is a castle, EMPTY_PIECE_CODE otherwise
+        int enPassantSquareIndex;           // Prior PositionState, -1 if there was no en passant square
+        Team teamToMove;
+        int halfmoveClock;
+        std::uint64_t positionHash;
+    };
+
+    /**
+     * ScopedBoardMove Class
+     * Applies a move to a StandardChessBoardImpl in place for the lifetime of the guard, reverting it on destruction
+     * Leaves the undo and redo stacks untouched
+     */
+    class ScopedBoardMove final {
+    private:
+        StandardChessBoardImpl &chessBoard;
+        UndoRecord undoRecord;
+
+    public:
+        explicit ScopedBoardMove(StandardChessBoardImpl const &chessBoard, MoveCode moveCode);
+        ScopedBoardMove(ScopedBoardMove const &other) = delete;
+        ScopedBoardMove(ScopedBoardMove &&other) = delete;
+        ScopedBoardMove& operator=(ScopedBoardMove const &other) = delete;
+        ScopedBoardMove& operator=(ScopedBoardMove &&other) = delete;
+        ~ScopedBoardMove();
+    };
+
+    static int const numRowsOnBoard = 8;
+    static int const numColsOnBoard = 8;
+    static int const numSquares = numRowsOnBoard * numColsOnBoard;
+    static std::array<PieceType, 4> const promotionPieceTypes;
+
+    Team teamOne = Team::TEAM_ONE;
+    Team teamTwo = Team::TEAM_TWO;
+
+    std::array<PieceCode, numSquares> squares;              // Indexed by square index (row * 8 + col)
+
+    std::array<std::uint64_t, 2> teamOccupancy;             // Per Team
+    std::array<std::uint64_t, 6> pieceTypeOccupancy;        // Per PieceType
+    std::uint64_t northOccupancy;                           // Pieces facing NORTH, every other Piece faces SOUTH
+    std::uint64_t unmovedOccupancy;                         // Pieces whose hasMoved is false
+
+    PositionState positionState;
+
+    // Move history, only needed to undo and redo moves, not copied by clonePosition
+    std::vector<UndoRecord> undoRecords;
+    std::vector<MoveCode> redoMoveCodes;
+
+    std::shared_ptr<ZobristKeys const> zobristKeys;                 // Shared by all ChessBoards of the same size
+    std::shared_ptr<BoardGeometry const> boardGeometry;             // Shared by all ChessBoards of the same size
+    std::shared_ptr<MagicAttackTables const> magicAttackTables;     // Shared by all StandardChessBoardImpls
+    std::uint64_t positionHash;                                     // Maintained incrementally as the StandardChessBoardImpl state changes
+
+    mutable std::array<std::vector<BoardSquare>, 2> pieceSquares;   // Per Team, rebuilt from the bitboards by getPieceSquares when invalid
+    mutable std::array<std::vector<BoardSquare>, 2> kingSquares;
+    mutable std::array<bool, 2> arePieceSquaresValid = { false, false };
+
+
+    /* Specific To StandardChessBoardImpl */
+    explicit StandardChessBoardImpl(StandardChessBoardImpl const &other, bool shouldCopyMoveHistory);
+
+    static std::uint64_t shiftSquares(std::uint64_t squares, int rowDirection, int colDirection);
+
+    int getSquareIndex(BoardSquare const &boardSquare) const;
+    BoardSquare getBoardSquare(int squareIndex) const;
+    PieceCode getPieceCodeAt(BoardSquare const &boardSquare) const;
+    int getTeamIndex(Team team) const;
+    Team getOtherTeam(Team team) const;
+    void setPieceCodeAt(int squareIndex, PieceCode newPieceCode);
+    void setEnPassantSquare(std::optional<BoardSquare> const &newEnPassantSquare);
+    UndoRecord applyMove(MoveCode moveCode);
+    void revertMove(UndoRecord const &undoRecord);
+
+    void clearRedoMoves();
+
+    void addTargetMoves(int fromSquareIndex, std::uint64_t targets, std::uint64_t otherTeamOccupancy, MoveList &moves) const;
+    void addPawnMoves(int fromSquareIndex, int toSquareIndex, PieceDirection pieceDirection, MoveKind moveKind, bool doesEnableEnpassant, bool isCapture, MoveList &moves) const;
+    void generatePawnMoves(Team team, PieceDirection pieceDirection, MoveList &moves) const;
+    void generateEnPassantMoves(Team team, MoveList &moves) const;
+    void generateCastleMoves(int kingSquareIndex, MoveList &moves) const;
+    void generateAllPseudoLegalMovesAtSquare(BoardSquare const &boardSquare, MoveList &moves) const;
+
+    bool isSquareIndexAttacked(int squareIndex, std::uint64_t occupancy, std::uint64_t attackingPieces) const;
+    bool isPseudoLegalMoveLegal(MoveCode moveCode, Team team) const;
+    void filterLegalMoves(MoveList &moves, int firstMoveIndex, Team team) const;
+    void refreshPieceSquares(Team team) const;
+
+    bool canMakeMove(Team team) const;
+
+    bool doesMoveApplyCheck(std::unique_ptr<BoardMove> const &boardMove) const;
+    bool doesMoveCapturePiece(std::unique_ptr<BoardMove> const &boardMove) const;
+    bool doesMoveLeavePieceAttacked(std::unique_ptr<BoardMove> const &boardMove) const;
+    bool doesMoveWinGame(std::unique_ptr<BoardMove> const &boardMove) const;
+
+
+    /* ChessBoard Interface Implementation */
+    std::optional<PieceData> getPieceDataAtImpl(BoardSquare const &boardSquare) const override;
+    std::optional<PieceInfo> getPieceInfoAtImpl(BoardSquare const &boardSquare) const override;
+
+    bool isSquareOnBoardImpl(BoardSquare const &boardSquare) const override;
+    bool isSquareEmptyImpl(BoardSquare const &boardSquare) const override;
+    bool isSquareSameTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const override;
+    bool isSquareOtherTeamImpl(BoardSquare const &boardSquare, Team ownTeam) const override;
+    bool isSquareAttackedImpl(BoardSquare const &boardSquare, Team ownTeam) const override;
+
+    bool isInCheckImpl(Team team) const override;
+    bool isInCheckMateImpl(Team team) const override;
+    bool isInStaleMateImpl(Team team) const override;
+
+    void generateAllLegalMovesAtSquareImpl(BoardSquare const &boardSquare, MoveList &moves) const override;
+    void generateAllLegalMovesImpl(Team team, MoveList &moves) const override;
+    void generateAllPseudoLegalMovesImpl(Team team, MoveList &moves) const override;
+    bool isPseudoLegalMoveLegalImpl(MoveCode moveCode) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateCheckApplyingMovesImpl(Team team) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateCapturingMovesImpl(Team team) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateCaptureAvoidingMovesImpl(Team team) const override;
+    std::vector<std::unique_ptr<BoardMove>> generateWinningMovesImpl(Team team) const override;
+    std::vector<ClassifiedMove> generateClassifiedMovesImpl(Team team) const override;
+
+    void setPositionImpl(BoardSquare const &boardSquare, PieceData const &pieceData) override;
+    void clearPositionImpl(BoardSquare const &boardSquare) override;
+    void clearBoardImpl() override;
+
+    std::optional<std::unique_ptr<BoardMove>> createBoardMoveImpl(BoardSquare const &fromSquare, BoardSquare const &toSquare, std::optional<PieceType> promotionPieceType = std::nullopt) const override;
+    bool isMoveLegalImpl(std::unique_ptr<BoardMove> const &boardMove) const override;
+    void makeMoveImpl(std::unique_ptr<BoardMove> const &boardMove) override;
+    void makeMoveImpl(MoveCode moveCode) override;
+    bool undoMoveImpl() override;                               // True if move is available to be undone (only performs undo if move available to be undone)
+    bool redoMoveImpl() override;                               // True if move is available to be redone (only performs redo if move available to be redone)
+
+    std::unique_ptr<ChessBoard> clonePositionImpl() const override;
+    std::optional<BoardSquare> getEnPassantSquareImpl() const override;
+    int getHalfmoveClockImpl() const override;
+    std::vector<BoardSquare> const& getPieceSquaresImpl(Team team) const override;
+    std::vector<BoardSquare> const& getKingSquaresImpl(Team team) const override;
+    std::uint64_t getPositionHashImpl() const override;
+    BoardGeometry const& getBoardGeometryImpl() const override;
+
+    Team getTeamToMoveImpl() const override;
+    void setTeamToMoveImpl(Team team) override;
+
+    Team getTeamOneImpl() const override;
+    Team getTeamTwoImpl() const override;
+
+    int getNumRowsOnBoardImpl() const override;
+    int getNumColsOnBoardImpl() const override;
+
+    BoardSquareIterator beginImpl() override;
+    BoardSquareIterator beginImpl() const override;
+    BoardSquareIterator cbeginImpl() const override;
+    BoardSquareIterator endImpl() override;
+    BoardSquareIterator endImpl() const override;
+    BoardSquareIterator cendImpl() const override;
+
+    ReverseBoardSquareIterator rbeginImpl() override;
+    ReverseBoardSquareIterator rbeginImpl() const override;
+    ReverseBoardSquareIterator crbeginImpl() const override;
+    ReverseBoardSquareIterator rendImpl() override;
+    ReverseBoardSquareIterator rendImpl() const override;
+    ReverseBoardSquareIterator crendImpl() const override;
+
+public:
+    explicit StandardChessBoardImpl(std::shared_ptr<ZobristKeys const> zobristKeys, std::shared_ptr<BoardGeometry const> boardGeometry,
+                                    std::shared_ptr<MagicAttackTables const> magicAttackTables);
+    StandardChessBoardImpl(StandardChessBoardImpl const &other);
+    StandardChessBoardImpl(StandardChessBoardImpl &&other) noexcept;
+    StandardChessBoardImpl& operator=(StandardChessBoardImpl const &other);
+    StandardChessBoardImpl& operator=(StandardChessBoardImpl &&other) noexcept;
+    virtual ~StandardChessBoardImpl() = default;
+
+    static bool isStandardPiece(PieceData const &pieceData);
+};
+
+
+#endif /* StandardChessBoardImpl_h */
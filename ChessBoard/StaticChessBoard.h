@@ -0,0 +1,54 @@
+// StaticChessBoard.h
+
+#ifndef StaticChessBoard_h
+#define StaticChessBoard_h
+
+#include <optional>
+
+#include "BoardGeometry.h"
+#include "BoardSquare.h"
+#include "Constants.h"
+#include "PieceData.h"
+#include "PieceInfo.h"
+
+
+/**
+ * StaticChessBoard Class
+ * Compile time counterpart of the square queries of the ChessBoard interface, for a final ChessBoard implementation to derive from (CRTP)
+ * - Each query calls the ...Impl of ChessBoardType directly, as ChessBoardType is final the call is not virtual and can be inlined
+ * - ChessBoardType brings these queries into scope with using declarations, hiding the virtual ones of ChessBoard for callers holding a ChessBoardType
+ * Templates over the ChessBoard they probe (PieceMoveGenerator) work with both: instantiated against ChessBoard every probe is a virtual call,
+ * instantiated against ChessBoardType inside its own translation unit the whole probe chain is resolved at compile time
+ */
+template <typename ChessBoardType>
+class StaticChessBoard {
+private:
+    ChessBoardType const& getChessBoard() const { return static_cast<ChessBoardType const&>(*this); }
+
+protected:
+    StaticChessBoard() = default;
+    StaticChessBoard(StaticChessBoard const &other) = default;
+    StaticChessBoard(StaticChessBoard &&other) noexcept = default;
+    StaticChessBoard& operator=(StaticChessBoard const &other) = default;
+    StaticChessBoard& operator=(StaticChessBoard &&other) noexcept = default;
+    ~StaticChessBoard() = default;
+
+public:
+    std::optional<PieceData> getPieceDataAt(BoardSquare const &boardSquare) const { return getChessBoard().getPieceDataAtImpl(boardSquare); }
+    std::optional<PieceInfo> getPieceInfoAt(BoardSquare const &boardSquare) const { return getChessBoard().getPieceInfoAtImpl(boardSquare); }
+
+    bool isSquareOnBoard(BoardSquare const &boardSquare) const { return getChessBoard().isSquareOnBoardImpl(boardSquare); }
+    bool isSquareEmpty(BoardSquare const &boardSquare) const { return getChessBoard().isSquareEmptyImpl(boardSquare); }
+    bool isSquareSameTeam(BoardSquare const &boardSquare, Team ownTeam) const { return getChessBoard().isSquareSameTeamImpl(boardSquare, ownTeam); }
+    bool isSquareOtherTeam(BoardSquare const &boardSquare, Team ownTeam) const { return getChessBoard().isSquareOtherTeamImpl(boardSquare, ownTeam); }
+    bool isSquareAttacked(BoardSquare const &boardSquare, Team ownTeam) const { return getChessBoard().isSquareAttackedImpl(boardSquare, ownTeam); }
+
+    std::optional<BoardSquare> getEnPassantSquare() const { return getChessBoard().getEnPassantSquareImpl(); }
+    BoardGeometry const& getBoardGeometry() const { return getChessBoard().getBoardGeometryImpl(); }
+
+    int getNumRowsOnBoard() const { return getChessBoard().getNumRowsOnBoardImpl(); }
+    int getNumColsOnBoard() const { return getChessBoard().getNumColsOnBoardImpl(); }
+};
+
+
+#endif /* StaticChessBoard_h */
@@ -0,0 +1,100 @@
+// ZobristKeys.cc
+
+#include "ZobristKeys.h"
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "PieceCode.h"
+
+
+/*
+ * Basic ctor
+ * Keys are drawn from a fixed seed so that hashes are reproducible between runs
+ */
+ZobristKeys::ZobristKeys(int numRowsOnBoard, int numColsOnBoard) :
+    numRowsOnBoard(numRowsOnBoard), numColsOnBoard(numColsOnBoard),
+    pieceKeys(numRowsOnBoard * numColsOnBoard * numPieceCodes, 0), enPassantKeys(numRowsOnBoard * numColsOnBoard, 0), sideToMoveKey(0) {
+
+    std::mt19937_64 generator(0x9E3779B97F4A7C15ULL ^ (static_cast<std::uint64_t>(numRowsOnBoard) << 32) ^ static_cast<std::uint64_t>(numColsOnBoard));
+    for (int squareIndex = 0; squareIndex < numRowsOnBoard * numColsOnBoard; ++squareIndex) {
+        for (int pieceCode = 0; pieceCode < numPieceCodes; ++pieceCode) {
+            if (PieceCodeUtilities::isPiece(pieceCode)) {
+                pieceKeys[squareIndex * numPieceCodes + pieceCode] = generator();
+            }
+        }
+        enPassantKeys[squareIndex] = generator();
+    }
+    sideToMoveKey = generator();
+}
+
+/*
+ * Copy ctor
+ */
+ZobristKeys::ZobristKeys(ZobristKeys const &other) :
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard),
+    pieceKeys(other.pieceKeys), enPassantKeys(other.enPassantKeys), sideToMoveKey(other.sideToMoveKey) { }
+
+/*
+ * Move ctor
+ */
+ZobristKeys::ZobristKeys(ZobristKeys &&other) noexcept :
+    numRowsOnBoard(other.numRowsOnBoard), numColsOnBoard(other.numColsOnBoard),
+    pieceKeys(std::move(other.pieceKeys)), enPassantKeys(std::move(other.enPassantKeys)), sideToMoveKey(other.sideToMoveKey) { }
+
+/*
+ * Copy assignment
+ */
+ZobristKeys& ZobristKeys::operator=(ZobristKeys const &other) {
+    if (this != &other) {
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        pieceKeys = other.pieceKeys;
+        enPassantKeys = other.enPassantKeys;
+        sideToMoveKey = other.sideToMoveKey;
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+ZobristKeys& ZobristKeys::operator=(ZobristKeys &&other) noexcept {
+    if (this != &other) {
+        numRowsOnBoard = other.numRowsOnBoard;
+        numColsOnBoard = other.numColsOnBoard;
+        pieceKeys = std::move(other.pieceKeys);
+        enPassantKeys = std::move(other.enPassantKeys);
+        sideToMoveKey = other.sideToMoveKey;
+    }
+    return *this;
+}
+
+/*
+ * Returns the index of the square at the row and col arguments
+ */
+int ZobristKeys::getSquareIndex(int boardRow, int boardCol) const {
+    return boardRow * numColsOnBoard + boardCol;
+}
+
+/*
+ * Returns the key of the PieceCode argument at the square argument
+ * - 0 if the PieceCode argument does not represent a Piece
+ */
+std::uint64_t ZobristKeys::getPieceKey(int boardRow, int boardCol, PieceCode pieceCode) const {
+    return pieceKeys[getSquareIndex(boardRow, boardCol) * numPieceCodes + pieceCode];
+}
+
+/*
+ * Returns the key of the en passant square argument
+ */
+std::uint64_t ZobristKeys::getEnPassantKey(int boardRow, int boardCol) const {
+    return enPassantKeys[getSquareIndex(boardRow, boardCol)];
+}
+
+/* Getters */
+std::uint64_t ZobristKeys::getSideToMoveKey() const { return sideToMoveKey; }
+int ZobristKeys::getNumRowsOnBoard() const { return numRowsOnBoard; }
+int ZobristKeys::getNumColsOnBoard() const { return numColsOnBoard; }
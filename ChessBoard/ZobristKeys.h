@@ -0,0 +1,48 @@
+// ZobristKeys.h
+
+#ifndef ZobristKeys_h
+#define ZobristKeys_h
+
+#include <cstdint>
+#include <vector>
+
+#include "PieceCode.h"
+
+
+/**
+ * ZobristKeys Class
+ * Random 64 bit keys used to incrementally hash ChessBoard positions of a fixed size
+ * - One key per (square, PieceCode) pair, covering PieceType, PieceLevel, Team, PieceDirection and hasMoved
+ * - One key per square for the en passant square
+ * - One key for the side to move
+ */
+class ZobristKeys final {
+private:
+    static int const numPieceCodes = 256;
+
+    int numRowsOnBoard;
+    int numColsOnBoard;
+    std::vector<std::uint64_t> pieceKeys;           // Indexed by square index * numPieceCodes + PieceCode, 0 for non Piece codes
+    std::vector<std::uint64_t> enPassantKeys;       // Indexed by square index
+    std::uint64_t sideToMoveKey;
+
+    int getSquareIndex(int boardRow, int boardCol) const;
+
+public:
+    explicit ZobristKeys(int numRowsOnBoard, int numColsOnBoard);
+    ZobristKeys(ZobristKeys const &other);
+    ZobristKeys(ZobristKeys &&other) noexcept;
+    ZobristKeys& operator=(ZobristKeys const &other);
+    ZobristKeys& operator=(ZobristKeys &&other) noexcept;
+    ~ZobristKeys() = default;
+
+    std::uint64_t getPieceKey(int boardRow, int boardCol, PieceCode pieceCode) const;
+    std::uint64_t getEnPassantKey(int boardRow, int boardCol) const;
+    std::uint64_t getSideToMoveKey() const;
+
+    int getNumRowsOnBoard() const;
+    int getNumColsOnBoard() const;
+};
+
+
+#endif /* ZobristKeys_h */
@@ -10,7 +10,9 @@
 
 #include "BoardMove.h"
 #include "ChessBoard.h"
+#include "ClassifiedMove.h"
 #include "Constants.h"
+#include "MoveCode.h"
 
 
 /*
@@ -59,6 +61,29 @@ void ComputerPlayer::shuffle(std::vector<std::unique_ptr<BoardMove>> &moves) con
     std::shuffle(moves.begin(), moves.end(), std::default_random_engine(seed));
 }
 
+/*
+ * Returns the MoveCodes of the ClassifiedMoves argument that have every required MoveFlag and none of the excluded MoveFlags, in order
+ */
+std::vector<MoveCode> ComputerPlayer::filterClassifiedMoves(std::vector<ClassifiedMove> const &classifiedMoves, MoveFlags requiredFlags, MoveFlags excludedFlags) const {
+    std::vector<MoveCode> moves;
+    for (ClassifiedMove const &classifiedMove : classifiedMoves) {
+        if (classifiedMove.hasFlags(requiredFlags, excludedFlags)) {
+            moves.push_back(classifiedMove.moveCode);
+        }
+    }
+    return moves;
+}
+
+/*
+ * Returns a uniformly random MoveCode from the non empty MoveCodes argument
+ */
+MoveCode ComputerPlayer::chooseRandomMove(std::vector<MoveCode> const &moves) const {
+    unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
+    std::default_random_engine randomEngine(seed);
+    std::uniform_int_distribution<int> moveIndexDistribution(0, moves.size() - 1);
+    return moves[moveIndexDistribution(randomEngine)];
+}
+
 /* Public Virtual Methods */
 std::unique_ptr<BoardMove> ComputerPlayer::generateMove(std::unique_ptr<ChessBoard> const &chessBoard) const { return generateMoveImpl(chessBoard); }
 std::unique_ptr<ComputerPlayer> ComputerPlayer::clone() const { return cloneImpl(); }
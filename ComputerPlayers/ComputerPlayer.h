@@ -8,7 +8,9 @@
 
 #include "BoardMove.h"
 #include "ChessBoard.h"
+#include "ClassifiedMove.h"
 #include "Constants.h"
+#include "MoveCode.h"
 
 
 /**
@@ -29,6 +31,8 @@ protected:
     ComputerPlayer& operator=(ComputerPlayer &&other) noexcept;
 
     void shuffle(std::vector<std::unique_ptr<BoardMove>> &moves) const;
+    std::vector<MoveCode> filterClassifiedMoves(std::vector<ClassifiedMove> const &classifiedMoves, MoveFlags requiredFlags, MoveFlags excludedFlags = NO_MOVE_FLAGS) const;
+    MoveCode chooseRandomMove(std::vector<MoveCode> const &moves) const;
 
 public:
     virtual ~ComputerPlayer() = default;
@@ -2,8 +2,11 @@
 
 #include "LevelFiveComputer.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -12,6 +15,8 @@
 #include "Cloneable.h"
 #include "ComputerPlayer.h"
 #include "Constants.h"
+#include "MoveCode.h"
+#include "MovePicker.h"
 
 
 #pragma mark - ScoredAlphaBetaMove
@@ -26,42 +31,8 @@ const LevelFiveComputer::ScoredAlphaBetaMove LevelFiveComputer::emptyScoredAlpha
 /*
  * Basic ctor
  */
-LevelFiveComputer::ScoredAlphaBetaMove::ScoredAlphaBetaMove(int alphaBetaScore, std::optional<std::unique_ptr<BoardMove>> const &boardMove) :
-    alphaBetaScore(alphaBetaScore), boardMove(boardMove.has_value() ? std::make_optional<std::unique_ptr<BoardMove>>(boardMove.value()->clone()) : std::nullopt) { }
-
-/*
- * Copy ctor
- */
-LevelFiveComputer::ScoredAlphaBetaMove::ScoredAlphaBetaMove(ScoredAlphaBetaMove const &other) :
-    alphaBetaScore(other.alphaBetaScore), boardMove(other.boardMove.has_value() ? std::make_optional<std::unique_ptr<BoardMove>>(other.boardMove.value()->clone()) : std::nullopt) { }
-
-/*
- * Move ctor
- */
-LevelFiveComputer::ScoredAlphaBetaMove::ScoredAlphaBetaMove(ScoredAlphaBetaMove &&other) noexcept :
-    alphaBetaScore(other.alphaBetaScore), boardMove(std::move(other.boardMove)) {}
-
-/*
- * Copy assignment
- */
-LevelFiveComputer::ScoredAlphaBetaMove& LevelFiveComputer::ScoredAlphaBetaMove::operator=(ScoredAlphaBetaMove const &other) {
-    if (this != &other) {
-        alphaBetaScore = other.alphaBetaScore;
-        boardMove = other.boardMove.has_value() ? std::make_optional<std::unique_ptr<BoardMove>>(other.boardMove.value()->clone()) : std::nullopt;
-    }
-    return *this;
-}
-
-/*
- * Move assignment
- */
-LevelFiveComputer::ScoredAlphaBetaMove& LevelFiveComputer::ScoredAlphaBetaMove::operator=(ScoredAlphaBetaMove &&other) noexcept {
-    if (this != &other) {
-        alphaBetaScore = other.alphaBetaScore;
-        boardMove = std::move(other.boardMove);
-    }
-    return *this;
-}
+LevelFiveComputer::ScoredAlphaBetaMove::ScoredAlphaBetaMove(int alphaBetaScore, std::optional<MoveCode> moveCode) :
+    alphaBetaScore(alphaBetaScore), moveCode(moveCode) { }
 
 
 #pragma mark - ScoredBoardMove
@@ -112,20 +83,23 @@ LevelFiveComputer::ScoredBoardMove& LevelFiveComputer::ScoredBoardMove::operator
 /*
  * Basic ctor
  */
-LevelFiveComputer::LevelFiveComputer(Team team) : 
-    Cloneable<ComputerPlayer, LevelFiveComputer>(team) { }
+LevelFiveComputer::LevelFiveComputer(Team team, int searchDepth, bool shouldRandomizeTies) :
+    Cloneable<ComputerPlayer, LevelFiveComputer>(team), searchDepth(searchDepth), shouldRandomizeTies(shouldRandomizeTies) {
+
+    assert(searchDepth > 0);
+}
 
 /*
  * Copy ctor
  */
 LevelFiveComputer::LevelFiveComputer(LevelFiveComputer const &other) :
-    Cloneable<ComputerPlayer, LevelFiveComputer>(other) { }
+    Cloneable<ComputerPlayer, LevelFiveComputer>(other), searchDepth(other.searchDepth), shouldRandomizeTies(other.shouldRandomizeTies), numNodesSearched(other.numNodesSearched) { }
 
 /*
  * Move ctor
  */
 LevelFiveComputer::LevelFiveComputer(LevelFiveComputer &&other) noexcept :
-    Cloneable<ComputerPlayer, LevelFiveComputer>(std::move(other)) { }
+    Cloneable<ComputerPlayer, LevelFiveComputer>(std::move(other)), searchDepth(other.searchDepth), shouldRandomizeTies(other.shouldRandomizeTies), numNodesSearched(other.numNodesSearched) { }
 
 /*
  * Copy assignment
@@ -133,6 +107,9 @@ LevelFiveComputer::LevelFiveComputer(LevelFiveComputer &&other) noexcept :
 LevelFiveComputer& LevelFiveComputer::operator=(LevelFiveComputer &other) {
     if (this != &other) {
         ComputerPlayer::operator=(other);
+        searchDepth = other.searchDepth;
+        shouldRandomizeTies = other.shouldRandomizeTies;
+        numNodesSearched = other.numNodesSearched;
     }
     return *this;
 }
@@ -143,6 +120,9 @@ LevelFiveComputer& LevelFiveComputer::operator=(LevelFiveComputer &other) {
 LevelFiveComputer& LevelFiveComputer::operator=(LevelFiveComputer &&other) noexcept {
     if (this != &other) {
         ComputerPlayer::operator=(std::move(other));
+        searchDepth = other.searchDepth;
+        shouldRandomizeTies = other.shouldRandomizeTies;
+        numNodesSearched = other.numNodesSearched;
     }
     return *this;
 }
@@ -151,8 +131,9 @@ LevelFiveComputer& LevelFiveComputer::operator=(LevelFiveComputer &&other) noexc
  * Generate a move
  */
 std::unique_ptr<BoardMove> LevelFiveComputer::generateMoveImpl(std::unique_ptr<ChessBoard> const &chessBoard) const {
-    std::unique_ptr<ChessBoard> tempChessBoard = chessBoard->clone();
-    return getBestAlphaBetaMove(tempChessBoard, team, depth, -KING_SCORE, KING_SCORE).boardMove.value();
+    std::unique_ptr<ChessBoard> tempChessBoard = chessBoard->clonePosition();
+    MoveCode bestMoveCode = getBestAlphaBetaMove(tempChessBoard, team, searchDepth, -KING_SCORE, KING_SCORE).moveCode.value();
+    return MoveCodeUtilities::decode(bestMoveCode, *chessBoard);
 }
 
 /*
@@ -161,7 +142,8 @@ std::unique_ptr<BoardMove> LevelFiveComputer::generateMoveImpl(std::unique_ptr<C
 LevelFiveComputer::ScoredAlphaBetaMove LevelFiveComputer::getBestAlphaBetaMove(std::unique_ptr<ChessBoard> &tempChessBoard, Team currentTeam, int currentDepth, int alpha, int beta) const {
     static int const positiveInfinity = std::numeric_limits<int>::max();
     static int const negativeInfinity = std::numeric_limits<int>::min();
-    
+    ++numNodesSearched;
+
     // End of recursion
     if (currentDepth == 0) {
         return tempChessBoard->isInStaleMate(currentTeam)
@@ -174,19 +156,38 @@ LevelFiveComputer::ScoredAlphaBetaMove LevelFiveComputer::getBestAlphaBetaMove(s
         ? negativeInfinity 
         : positiveInfinity;
  
-    // Rank the moves before playing them out, speeds up alpha-beta
-    std::vector<std::unique_ptr<BoardMove>> rankedMoves = generateRankedMoves(tempChessBoard, currentTeam);
+    // Rank every move at the root so equally scored moves are chosen randomly,
+    // below it pick moves lazily so a cutoff skips the legality tests of the moves not yet reached
+    std::vector<MoveCode> rankedMoveCodes;
+    if (currentDepth == searchDepth) {
+        for (std::unique_ptr<BoardMove> const &rankedMove : generateRankedMoves(tempChessBoard, currentTeam)) {
+            rankedMoveCodes.emplace_back(MoveCodeUtilities::encode(*rankedMove, *tempChessBoard));
+        }
+        if (currentTeam != tempChessBoard->getTeamOne()) {
+            std::reverse(rankedMoveCodes.begin(), rankedMoveCodes.end());
+        }
+    }
+    std::vector<MoveCode>::const_iterator nextRankedMoveCode = rankedMoveCodes.cbegin();
+    MovePicker movePicker(*tempChessBoard, currentTeam);
+    auto getNextMoveCode = [&]() -> std::optional<MoveCode> {
+        if (currentDepth != searchDepth) {
+            return movePicker.next();
+        }
+        return nextRankedMoveCode != rankedMoveCodes.cend()
+            ? std::optional<MoveCode>(*nextRankedMoveCode++)
+            : std::nullopt;
+    };
 
     // Determine the best move
-    std::unique_ptr<BoardMove> bestMove;
+    std::optional<MoveCode> bestMoveCode;
     if (currentTeam == tempChessBoard->getTeamOne()) {
-        for (std::unique_ptr<BoardMove> const &rankedMove : rankedMoves) {
-            tempChessBoard->makeMove(rankedMove);
+        for (std::optional<MoveCode> moveCode = getNextMoveCode(); moveCode.has_value(); moveCode = getNextMoveCode()) {
+            tempChessBoard->makeMove(moveCode.value());
             int currentScore = getBestAlphaBetaMove(tempChessBoard, tempChessBoard->getTeamTwo(), currentDepth - 1, alpha, beta).alphaBetaScore;
             tempChessBoard->undoMove();
             if (currentScore > bestScore) {
                 bestScore = currentScore;
-                bestMove = rankedMove->clone();
+                bestMoveCode = moveCode;
             }
             if (bestScore >= beta) {
                 break;
@@ -195,14 +196,13 @@ LevelFiveComputer::ScoredAlphaBetaMove LevelFiveComputer::getBestAlphaBetaMove(s
             }
         }
     } else {
-        std::reverse(rankedMoves.begin(), rankedMoves.end());
-        for (std::unique_ptr<BoardMove> const &rankedMove : rankedMoves) {
-            tempChessBoard->makeMove(rankedMove);
+        for (std::optional<MoveCode> moveCode = getNextMoveCode(); moveCode.has_value(); moveCode = getNextMoveCode()) {
+            tempChessBoard->makeMove(moveCode.value());
             int currentScore = getBestAlphaBetaMove(tempChessBoard, tempChessBoard->getTeamOne(), currentDepth - 1, alpha, beta).alphaBetaScore;
             tempChessBoard->undoMove();    
             if (currentScore < bestScore) {
                 bestScore = currentScore;
-                bestMove = rankedMove->clone();
+                bestMoveCode = moveCode;
             }
             if (bestScore <= alpha) {
                 break;
@@ -220,7 +220,7 @@ LevelFiveComputer::ScoredAlphaBetaMove LevelFiveComputer::getBestAlphaBetaMove(s
     }
 
     // Return the best move
-    return ScoredAlphaBetaMove(bestScore, std::make_optional<std::unique_ptr<BoardMove>>(std::move(bestMove)));
+    return ScoredAlphaBetaMove(bestScore, bestMoveCode);
 }
 
 /*
@@ -314,7 +314,9 @@ std::vector<std::unique_ptr<BoardMove>> LevelFiveComputer::generateRankedMoves(s
         if (scoredBoardMove.score == scoreCurrentlyProcessing) {
             boardMovesWithCurrentScore.emplace_back(std::move(scoredBoardMove.boardMove));
         } else {
-            shuffle(boardMovesWithCurrentScore);
+            if (shouldRandomizeTies) {
+                shuffle(boardMovesWithCurrentScore);
+            }
             for (std::unique_ptr<BoardMove> &boardMoveWithCurrentScore : boardMovesWithCurrentScore) {
                 rankedBoardMoves.emplace_back(std::move(boardMoveWithCurrentScore));
             }
@@ -324,7 +326,9 @@ std::vector<std::unique_ptr<BoardMove>> LevelFiveComputer::generateRankedMoves(s
         }
     }
     // Randomize last group of moves (those with the lowest score)
-    shuffle(boardMovesWithCurrentScore);
+    if (shouldRandomizeTies) {
+        shuffle(boardMovesWithCurrentScore);
+    }
     for (std::unique_ptr<BoardMove> &boardMoveWithCurrentScore : boardMovesWithCurrentScore) {
         rankedBoardMoves.emplace_back(std::move(boardMoveWithCurrentScore));
     }
@@ -332,3 +336,7 @@ std::vector<std::unique_ptr<BoardMove>> LevelFiveComputer::generateRankedMoves(s
     // Return the ranked moves
     return rankedBoardMoves;
 }
+
+/* Getters */
+int LevelFiveComputer::getSearchDepth() const { return searchDepth; }
+std::uint64_t LevelFiveComputer::getNumNodesSearched() const { return numNodesSearched; }
@@ -3,6 +3,7 @@
 #ifndef LevelFiveComputer_h
 #define LevelFiveComputer_h
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -12,6 +13,7 @@
 #include "Cloneable.h"
 #include "ComputerPlayer.h"
 #include "Constants.h"
+#include "MoveCode.h"
 
 
 /**
@@ -23,17 +25,18 @@ private:
     /**
      * ScoredAlphaBetaMove Struct
      * Used by alpha-beta algorithm when determining best possible move
+     * Holds the move as a MoveCode so that it is trivially copyable, decoded to a BoardMove only at the root
      */
     struct ScoredAlphaBetaMove final {
         int alphaBetaScore;
-        std::optional<std::unique_ptr<BoardMove>> boardMove;
-
-        explicit ScoredAlphaBetaMove(int alphaBetaScore, std::optional<std::unique_ptr<BoardMove>> const &boardMove = std::nullopt);
-        ScoredAlphaBetaMove(ScoredAlphaBetaMove const &other);
-        ScoredAlphaBetaMove(ScoredAlphaBetaMove &&other) noexcept;  
-        ScoredAlphaBetaMove& operator=(ScoredAlphaBetaMove const &other);
-        ScoredAlphaBetaMove& operator=(ScoredAlphaBetaMove &&other) noexcept;
-        virtual ~ScoredAlphaBetaMove() = default;
+        std::optional<MoveCode> moveCode;
+
+        explicit ScoredAlphaBetaMove(int alphaBetaScore, std::optional<MoveCode> moveCode = std::nullopt);
+        ScoredAlphaBetaMove(ScoredAlphaBetaMove const &other) = default;
+        ScoredAlphaBetaMove(ScoredAlphaBetaMove &&other) noexcept = default;
+        ScoredAlphaBetaMove& operator=(ScoredAlphaBetaMove const &other) = default;
+        ScoredAlphaBetaMove& operator=(ScoredAlphaBetaMove &&other) noexcept = default;
+        ~ScoredAlphaBetaMove() = default;
     };
     static ScoredAlphaBetaMove const emptyScoredAlphaBetaMove;
 
@@ -53,20 +56,29 @@ private:
         virtual ~ScoredBoardMove() = default;
     };
 
-    static int const depth = 3;
+    static int const defaultSearchDepth = 3;
+    int searchDepth;                                // Plies searched from the root
+    bool shouldRandomizeTies;                       // Shuffles equally ranked root moves, off for a reproducible search
+    mutable std::uint64_t numNodesSearched = 0;     // Positions visited by every search so far
+
     std::unique_ptr<BoardMove> generateMoveImpl(std::unique_ptr<ChessBoard> const &chessBoard) const override;
 
     ScoredAlphaBetaMove getBestAlphaBetaMove(std::unique_ptr<ChessBoard> &tempChessBoard, Team currentTeam, int currentDepth, int alpha, int beta) const;
-    int getAlphaBetaBoardScore(std::unique_ptr<ChessBoard> const &currentChessBoard, Team currentTeam) const;
     std::vector<std::unique_ptr<BoardMove>> generateRankedMoves(std::unique_ptr<ChessBoard> const &currentChessBoard, Team currentTeam) const;
 
 public:
-    explicit LevelFiveComputer(Team team);
+    explicit LevelFiveComputer(Team team, int searchDepth = defaultSearchDepth, bool shouldRandomizeTies = true);
     LevelFiveComputer(LevelFiveComputer const &other);
     LevelFiveComputer(LevelFiveComputer &&other) noexcept;
     LevelFiveComputer& operator=(LevelFiveComputer &other);
     LevelFiveComputer& operator=(LevelFiveComputer &&other) noexcept;
     virtual ~LevelFiveComputer() = default;
+
+    int getAlphaBetaBoardScore(std::unique_ptr<ChessBoard> const &currentChessBoard, Team currentTeam) const;     // Static evaluation at the leaves of the search
+
+    /* Getters */
+    int getSearchDepth() const;
+    std::uint64_t getNumNodesSearched() const;
 };
 
 
@@ -8,9 +8,11 @@
 
 #include "BoardMove.h"
 #include "ChessBoard.h"
+#include "ClassifiedMove.h"
 #include "Cloneable.h"
 #include "ComputerPlayer.h"
 #include "Constants.h"
+#include "MoveCode.h"
 
 
 /*
@@ -59,38 +61,27 @@ LevelThreeComputer& LevelThreeComputer::operator=(LevelThreeComputer &&other) no
  * 4) Random move
  */
 std::unique_ptr<BoardMove> LevelThreeComputer::generateMoveImpl(std::unique_ptr<ChessBoard> const &chessBoard) const {
+    std::vector<ClassifiedMove> classifiedMoves = chessBoard->generateClassifiedMoves(team);
+
     // Game winning moves
-    std::vector<std::unique_ptr<BoardMove>> winningMoves = chessBoard->generateWinningMoves(team);
+    std::vector<MoveCode> winningMoves = filterClassifiedMoves(classifiedMoves, WINS_GAME_FLAG);
     if (!winningMoves.empty()) {
-        return winningMoves.front()->clone();
+        return MoveCodeUtilities::decode(winningMoves.front(), *chessBoard);
     }
 
     // Capturing and capture avoiding moves
-    std::vector<std::unique_ptr<BoardMove>> capturingAndCaptureAvoidingMoves;
-    std::vector<std::unique_ptr<BoardMove>> capturingMoves = chessBoard->generateCapturingMoves(team);
-    std::vector<std::unique_ptr<BoardMove>> captureAvoidingMoves = chessBoard->generateCaptureAvoidingMoves(team);
-    for (std::unique_ptr<BoardMove> const &capturingMove : capturingMoves) {
-        for (std::unique_ptr<BoardMove> const &captureAvoidingMove : captureAvoidingMoves) {
-            if (*capturingMove == *captureAvoidingMove) {
-                capturingAndCaptureAvoidingMoves.emplace_back(capturingMove->clone());
-                break;
-            }
-        }
-    }
+    std::vector<MoveCode> capturingAndCaptureAvoidingMoves = filterClassifiedMoves(classifiedMoves, CAPTURES_PIECE_FLAG, LEAVES_PIECE_ATTACKED_FLAG);
     if (!capturingAndCaptureAvoidingMoves.empty()) {
-        shuffle(capturingAndCaptureAvoidingMoves);
-        return capturingAndCaptureAvoidingMoves.front()->clone();
+        return MoveCodeUtilities::decode(chooseRandomMove(capturingAndCaptureAvoidingMoves), *chessBoard);
     }
 
     // Capture avoiding moves
+    std::vector<MoveCode> captureAvoidingMoves = filterClassifiedMoves(classifiedMoves, NO_MOVE_FLAGS, LEAVES_PIECE_ATTACKED_FLAG);
     if (!captureAvoidingMoves.empty()) {
-        shuffle(captureAvoidingMoves);
-        return captureAvoidingMoves.front()->clone();
+        return MoveCodeUtilities::decode(chooseRandomMove(captureAvoidingMoves), *chessBoard);
     }
 
     // All moves
-    std::vector<std::unique_ptr<BoardMove>> allLegalMoves = chessBoard->generateAllLegalMoves(team);
-    shuffle(allLegalMoves);
-    
-    return allLegalMoves.front()->clone();
+    std::vector<MoveCode> allLegalMoves = filterClassifiedMoves(classifiedMoves, NO_MOVE_FLAGS);
+    return MoveCodeUtilities::decode(chooseRandomMove(allLegalMoves), *chessBoard);
 }
@@ -8,9 +8,11 @@
 
 #include "BoardMove.h"
 #include "ChessBoard.h"
+#include "ClassifiedMove.h"
 #include "Cloneable.h"
 #include "ComputerPlayer.h"
 #include "Constants.h"
+#include "MoveCode.h"
 
 
 /*
@@ -59,38 +61,27 @@ LevelTwoComputer& LevelTwoComputer::operator=(LevelTwoComputer &&other) noexcept
  * 4) Random move
  */
 std::unique_ptr<BoardMove> LevelTwoComputer::generateMoveImpl(std::unique_ptr<ChessBoard> const &chessBoard) const {
+    std::vector<ClassifiedMove> classifiedMoves = chessBoard->generateClassifiedMoves(team);
+
     // Game winning moves
-    std::vector<std::unique_ptr<BoardMove>> winningMoves = chessBoard->generateWinningMoves(team);
+    std::vector<MoveCode> winningMoves = filterClassifiedMoves(classifiedMoves, WINS_GAME_FLAG);
     if (!winningMoves.empty()) {
-        return winningMoves.front()->clone();
+        return MoveCodeUtilities::decode(winningMoves.front(), *chessBoard);
     }
 
     // Capturing and check applying moves
-    std::vector<std::unique_ptr<BoardMove>> capturingAndCheckApplyingMoves;
-    std::vector<std::unique_ptr<BoardMove>> capturingMoves = chessBoard->generateCapturingMoves(team);
-    std::vector<std::unique_ptr<BoardMove>> checkApplyingMoves = chessBoard->generateCheckApplyingMoves(team);
-    for (std::unique_ptr<BoardMove> const &capturingMove : capturingMoves) {
-        for (std::unique_ptr<BoardMove> const &checkApplyingMove : checkApplyingMoves) {
-            if (*capturingMove == *checkApplyingMove) {
-                capturingAndCheckApplyingMoves.emplace_back(capturingMove->clone());
-                break;
-            }
-        }
-    }
+    std::vector<MoveCode> capturingAndCheckApplyingMoves = filterClassifiedMoves(classifiedMoves, CAPTURES_PIECE_FLAG | APPLIES_CHECK_FLAG);
     if (!capturingAndCheckApplyingMoves.empty()) {
-        shuffle(capturingAndCheckApplyingMoves);
-        return capturingAndCheckApplyingMoves.front()->clone();
+        return MoveCodeUtilities::decode(chooseRandomMove(capturingAndCheckApplyingMoves), *chessBoard);
     }
 
     // Capturing moves
+    std::vector<MoveCode> capturingMoves = filterClassifiedMoves(classifiedMoves, CAPTURES_PIECE_FLAG);
     if (!capturingMoves.empty()) {
-        shuffle(capturingMoves);
-        return capturingMoves.front()->clone();
+        return MoveCodeUtilities::decode(chooseRandomMove(capturingMoves), *chessBoard);
     }
 
     // All moves
-    std::vector<std::unique_ptr<BoardMove>> allLegalMoves = chessBoard->generateAllLegalMoves(team);
-    shuffle(allLegalMoves);
-
-    return allLegalMoves.front()->clone();
+    std::vector<MoveCode> allLegalMoves = filterClassifiedMoves(classifiedMoves, NO_MOVE_FLAGS);
+    return MoveCodeUtilities::decode(chooseRandomMove(allLegalMoves), *chessBoard);
 }
@@ -25,6 +25,15 @@ enum class GameState {
     GAME_ACTIVE
 };
 
+/*
+ * The possible outcomes of a position for the Team to move
+ */
+enum class GameResult {
+    IN_PROGRESS,
+    CHECKMATE,
+    STALEMATE
+};
+
 /*
  * The different types of Players
  */
@@ -82,5 +91,14 @@ enum class PieceDirection {
     WEST,
 };
 
+/*
+ * The different ways a ChessBoard can store its position
+ */
+enum class ChessBoardBackend {
+    MAILBOX,        // A PieceCode per square, scanned square by square
+    BITBOARD,       // Bitboards of occupied squares, moves generated a whole set of squares at a time
+    AUTO,           // 64 bit magic bitboards on an 8x8 ChessBoard while it holds a standard setup, MAILBOX otherwise
+};
+
 
 #endif /* Constants_h */
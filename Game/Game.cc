@@ -487,6 +487,7 @@ void Game::processStartGameCommand(std::string const &teamOneStr, std::string co
 
             // Setup
             players = std::make_pair(std::move(playerOne), std::move(playerTwo));
+            chessBoard->setTeamToMove(currentTurn);
             setGameState(GameState::GAME_ACTIVE);
             notifyObservers();
             break;  
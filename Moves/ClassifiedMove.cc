@@ -0,0 +1,19 @@
+// ClassifiedMove.cc
+
+#include "ClassifiedMove.h"
+
+#include "MoveCode.h"
+
+
+/*
+ * Basic ctor
+ */
+ClassifiedMove::ClassifiedMove(MoveCode moveCode, MoveFlags moveFlags) :
+    moveCode(moveCode), moveFlags(moveFlags) { }
+
+/*
+ * True if every one of the required MoveFlags is set and none of the excluded MoveFlags are, false otherwise
+ */
+bool ClassifiedMove::hasFlags(MoveFlags requiredFlags, MoveFlags excludedFlags) const {
+    return (moveFlags & requiredFlags) == requiredFlags && (moveFlags & excludedFlags) == 0;
+}
@@ -0,0 +1,43 @@
+// ClassifiedMove.h
+
+#ifndef ClassifiedMove_h
+#define ClassifiedMove_h
+
+#include <cstdint>
+
+#include "MoveCode.h"
+
+
+/**
+ * MoveFlags
+ * Bit set describing the consequences of a legal move, filled in by ChessBoard::generateClassifiedMoves
+ */
+using MoveFlags = std::uint8_t;
+
+static MoveFlags const NO_MOVE_FLAGS = 0;
+static MoveFlags const CAPTURES_PIECE_FLAG = 1 << 0;           // Captures a Piece of the other Team
+static MoveFlags const APPLIES_CHECK_FLAG = 1 << 1;            // Leaves the other Team in check
+static MoveFlags const WINS_GAME_FLAG = 1 << 2;                // Leaves the other Team in checkmate
+static MoveFlags const LEAVES_PIECE_ATTACKED_FLAG = 1 << 3;    // Leaves the other Team with a legal capturing move
+
+
+/**
+ * ClassifiedMove Struct
+ * A legal move tagged with the MoveFlags that describe it
+ */
+struct ClassifiedMove final {
+    MoveCode moveCode;
+    MoveFlags moveFlags;
+
+    explicit ClassifiedMove(MoveCode moveCode, MoveFlags moveFlags);
+    ClassifiedMove(ClassifiedMove const &other) = default;
+    ClassifiedMove(ClassifiedMove &&other) noexcept = default;
+    ClassifiedMove& operator=(ClassifiedMove const &other) = default;
+    ClassifiedMove& operator=(ClassifiedMove &&other) noexcept = default;
+    ~ClassifiedMove() = default;
+
+    bool hasFlags(MoveFlags requiredFlags, MoveFlags excludedFlags = NO_MOVE_FLAGS) const;
+};
+
+
+#endif /* ClassifiedMove_h */
@@ -0,0 +1,141 @@
+// MoveCode.cc
+
+#include "MoveCode.h"
+
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "BoardMove.h"
+#include "BoardMoveFactory.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "Constants.h"
+#include "PieceData.h"
+
+
+/*
+ * Returns the MoveCode representing the BoardMove argument
+ * ChessBoard argument must be in the position the BoardMove argument is made from
+ */
+MoveCode MoveCodeUtilities::encode(BoardMove const &boardMove, ChessBoard const &chessBoard) {
+    BoardSquare const &fromSquare = boardMove.getFromSquare();
+    BoardSquare const &toSquare = boardMove.getToSquare();
+    bool isCastle = 
+        boardMove.getMovedPieceData().pieceType == PieceType::KING && 
+        (toSquare.boardRow == fromSquare.boardRow || toSquare.boardCol == fromSquare.boardCol) &&
+        std::abs(toSquare.boardRow - fromSquare.boardRow) + std::abs(toSquare.boardCol - fromSquare.boardCol) == 2;
+
+    return createMoveCode(chessBoard, fromSquare, toSquare, boardMove.getCaptureSquare(), isCastle, boardMove.getDoesEnableEnpassant(), boardMove.getPromotionPieceType());
+}
+
+/*
+ * Returns the BoardMove represented by the MoveCode argument
+ * ChessBoard argument must be in the position the MoveCode argument was encoded from (before the move is made)
+ */
+std::unique_ptr<BoardMove> MoveCodeUtilities::decode(MoveCode moveCode, ChessBoard const &chessBoard) {
+    int numColsOnBoard = chessBoard.getNumColsOnBoard();
+    BoardSquare fromSquare = getFromSquare(moveCode, numColsOnBoard);
+    BoardSquare toSquare = getToSquare(moveCode, numColsOnBoard);
+    BoardSquare captureSquare = getCaptureSquare(moveCode, numColsOnBoard);
+    bool doesEnableEnpassant = getDoesEnableEnpassant(moveCode);
+    PieceData movedPieceData = chessBoard.getPieceDataAt(fromSquare).value();
+    std::optional<PieceData> capturedPieceData = chessBoard.getPieceDataAt(captureSquare);
+
+    if (getMoveKind(moveCode) == MoveKind::CASTLE) {
+        BoardSquare rookFromSquare = getCastleRookFromSquare(moveCode, numColsOnBoard);
+        BoardSquare rookToSquare = getCastleRookToSquare(moveCode, numColsOnBoard);
+        return BoardMoveFactory::createCastleMove(fromSquare, toSquare, captureSquare, rookFromSquare, rookToSquare, doesEnableEnpassant, movedPieceData, capturedPieceData);
+    } else if (isPromotion(moveCode)) {
+        return BoardMoveFactory::createPromotionMove(fromSquare, toSquare, captureSquare, getPromotionPieceType(moveCode).value(), doesEnableEnpassant, movedPieceData, capturedPieceData);
+    } else {
+        return BoardMoveFactory::createStandardMove(fromSquare, toSquare, captureSquare, doesEnableEnpassant, movedPieceData, capturedPieceData);
+    }
+}
+
+/*
+ * Returns the move represented by the MoveCode argument in the notation of the move command, e.g. e7e8q
+ * The from and to squares are followed by the promotion PieceType if there is one
+ */
+std::string MoveCodeUtilities::toString(MoveCode moveCode, ChessBoard const &chessBoard) {
+    static std::string const promotionPieceTypeStrs = "kqrnbp";
+
+    int numRowsOnBoard = chessBoard.getNumRowsOnBoard();
+    int numColsOnBoard = chessBoard.getNumColsOnBoard();
+    auto boardSquareToString = [numRowsOnBoard](BoardSquare const &boardSquare) {
+        return std::string(1, static_cast<char>('a' + boardSquare.boardCol)) + std::to_string(numRowsOnBoard - boardSquare.boardRow);
+    };
+
+    std::string moveStr = boardSquareToString(getFromSquare(moveCode, numColsOnBoard)) + boardSquareToString(getToSquare(moveCode, numColsOnBoard));
+    std::optional<PieceType> promotionPieceType = getPromotionPieceType(moveCode);
+    if (promotionPieceType.has_value()) {
+        moveStr += promotionPieceTypeStrs[static_cast<int>(promotionPieceType.value())];
+    }
+    return moveStr;
+}
+
+/*
+ * Returns the square the moved Piece starts on
+ */
+BoardSquare MoveCodeUtilities::getFromSquare(MoveCode moveCode, int numColsOnBoard) {
+    int fromSquareIndex = getFromSquareIndex(moveCode);
+    return BoardSquare(fromSquareIndex / numColsOnBoard, fromSquareIndex % numColsOnBoard);
+}
+
+/*
+ * Returns the square the moved Piece ends on
+ */
+BoardSquare MoveCodeUtilities::getToSquare(MoveCode moveCode, int numColsOnBoard) {
+    int toSquareIndex = getToSquareIndex(moveCode);
+    return BoardSquare(toSquareIndex / numColsOnBoard, toSquareIndex % numColsOnBoard);
+}
+
+/*
+ * Returns the square of the Piece captured by the move (to square unless the move is an en passant capture)
+ */
+BoardSquare MoveCodeUtilities::getCaptureSquare(MoveCode moveCode, int numColsOnBoard) {
+    BoardSquare fromSquare = getFromSquare(moveCode, numColsOnBoard);
+    BoardSquare toSquare = getToSquare(moveCode, numColsOnBoard);
+    switch (getMoveKind(moveCode)) {
+        case MoveKind::EN_PASSANT_SAME_ROW:
+            return BoardSquare(fromSquare.boardRow, toSquare.boardCol);
+        case MoveKind::EN_PASSANT_SAME_COL:
+            return BoardSquare(toSquare.boardRow, fromSquare.boardCol);
+        default:
+            return toSquare;
+    }
+}
+
+/*
+ * Returns the square the Rook of the castle represented by the MoveCode argument moves from
+ * 4 squares beside the King towards row / col 0, 3 squares beside it away from row / col 0
+ */
+BoardSquare MoveCodeUtilities::getCastleRookFromSquare(MoveCode moveCode, int numColsOnBoard) {
+    BoardSquare fromSquare = getFromSquare(moveCode, numColsOnBoard);
+    BoardSquare toSquare = getToSquare(moveCode, numColsOnBoard);
+    int rowDirection = (toSquare.boardRow - fromSquare.boardRow) / 2;
+    int colDirection = (toSquare.boardCol - fromSquare.boardCol) / 2;
+    int rookDistance = rowDirection + colDirection < 0 ? 4 : 3;
+    return BoardSquare(fromSquare.boardRow + rookDistance * rowDirection, fromSquare.boardCol + rookDistance * colDirection);
+}
+
+/*
+ * Returns the square the Rook of the castle represented by the MoveCode argument moves to, the square the King passes over
+ */
+BoardSquare MoveCodeUtilities::getCastleRookToSquare(MoveCode moveCode, int numColsOnBoard) {
+    BoardSquare fromSquare = getFromSquare(moveCode, numColsOnBoard);
+    BoardSquare toSquare = getToSquare(moveCode, numColsOnBoard);
+    return BoardSquare((fromSquare.boardRow + toSquare.boardRow) / 2, (fromSquare.boardCol + toSquare.boardCol) / 2);
+}
+
+/*
+ * Create promotion PieceType Optional
+ * - value if the MoveCode argument is a promotion
+ * - nullopt otherwise
+ */
+std::optional<PieceType> MoveCodeUtilities::getPromotionPieceType(MoveCode moveCode) {
+    return isPromotion(moveCode)
+        ? std::make_optional<PieceType>(static_cast<PieceType>(((moveCode >> 24) & 0x03) + 1))
+        : std::nullopt;
+}
@@ -0,0 +1,129 @@
+// MoveCode.h
+
+#ifndef MoveCode_h
+#define MoveCode_h
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "BoardSquare.h"
+#include "Constants.h"
+
+// Forward declaration to avoid circular dependency with ChessBoard, which takes MoveCodes
+class BoardMove;
+class ChessBoard;
+
+
+/**
+ * MoveCode
+ * Compact, trivially copyable encoding of a BoardMove, for sorting, hashing and storing moves in flat arrays
+ * - Bits 0-9:   From square index (row * numColsOnBoard + col)
+ * - Bits 10-19: To square index
+ * - Bits 20-21: MoveKind
+ * - Bit 22:     doesEnableEnpassant
+ * - Bit 23:     Is a promotion
+ * - Bits 24-25: Promotion PieceType - 1 (QUEEN, ROOK, KNIGHT, BISHOP)
+ * - Bit 26:     Captures a Piece
+ * The capture square, the rook squares of a castle and the PieceData of the moved and captured Pieces are not stored,
+ * they are recovered from the ChessBoard the BoardMove is made on
+ */
+using MoveCode = std::uint32_t;
+
+/*
+ * The kinds of BoardMove distinguished by a MoveCode, determining where the capture square and any rook squares lie
+ */
+enum class MoveKind {
+    STANDARD,                   // Captures on the to square
+    EN_PASSANT_SAME_ROW,        // Captures on (fromRow, toCol)
+    EN_PASSANT_SAME_COL,        // Captures on (toRow, fromCol)
+    CASTLE                      // Rook moves from 4 (towards row / col 0) or 3 (away from row / col 0) squares beside the King to the square it passes over
+};
+
+
+/**
+ * Utility methods that operate on MoveCodes
+ */
+namespace MoveCodeUtilities {
+    inline MoveCode createMoveCode(int fromSquareIndex, int toSquareIndex, MoveKind moveKind, bool doesEnableEnpassant, std::optional<PieceType> promotionPieceType, bool isCapture) {
+        return static_cast<MoveCode>(
+            fromSquareIndex |
+            (toSquareIndex << 10) |
+            (static_cast<int>(moveKind) << 20) |
+            (static_cast<int>(doesEnableEnpassant) << 22) |
+            (static_cast<int>(promotionPieceType.has_value()) << 23) |
+            ((promotionPieceType.has_value() ? static_cast<int>(promotionPieceType.value()) - 1 : 0) << 24) |
+            (static_cast<int>(isCapture) << 26));
+    }
+
+    /*
+     * Returns the MoveCode of a move on the ChessBoard argument, which must be in the position the move is made from
+     * The kind of move is derived from the isCastle argument and from where the capture square lies relative to the to square
+     * Templated over the ChessBoard so that a StaticChessBoard can resolve its square probe at compile time
+     */
+    template <typename ChessBoardType>
+    MoveCode createMoveCode(ChessBoardType const &chessBoard, BoardSquare const &fromSquare, BoardSquare const &toSquare, BoardSquare const &captureSquare, bool isCastle, bool doesEnableEnpassant, std::optional<PieceType> promotionPieceType) {
+        int numColsOnBoard = chessBoard.getNumColsOnBoard();
+
+        MoveKind moveKind = MoveKind::STANDARD;
+        if (isCastle) {
+            moveKind = MoveKind::CASTLE;
+        } else if (captureSquare != toSquare) {
+            moveKind = captureSquare.boardRow == fromSquare.boardRow
+                ? MoveKind::EN_PASSANT_SAME_ROW
+                : MoveKind::EN_PASSANT_SAME_COL;
+        }
+
+        return createMoveCode(
+            fromSquare.boardRow * numColsOnBoard + fromSquare.boardCol, toSquare.boardRow * numColsOnBoard + toSquare.boardCol,
+            moveKind, doesEnableEnpassant, promotionPieceType, !chessBoard.isSquareEmpty(captureSquare));
+    }
+
+    /*
+     * Returns the MoveCode of a standard move, mirrors BoardMoveFactory::createStandardMove
+     */
+    template <typename ChessBoardType>
+    MoveCode createStandardMoveCode(ChessBoardType const &chessBoard, BoardSquare const &fromSquare, BoardSquare const &toSquare, BoardSquare const &captureSquare, bool doesEnableEnpassant) {
+        return createMoveCode(chessBoard, fromSquare, toSquare, captureSquare, false, doesEnableEnpassant, std::nullopt);
+    }
+
+    /*
+     * Returns the MoveCode of a promotion move, mirrors BoardMoveFactory::createPromotionMove
+     */
+    template <typename ChessBoardType>
+    MoveCode createPromotionMoveCode(ChessBoardType const &chessBoard, BoardSquare const &fromSquare, BoardSquare const &toSquare, BoardSquare const &captureSquare, PieceType promotionPieceType, bool doesEnableEnpassant) {
+        return createMoveCode(chessBoard, fromSquare, toSquare, captureSquare, false, doesEnableEnpassant, promotionPieceType);
+    }
+
+    /*
+     * Returns the MoveCode of a castle, mirrors BoardMoveFactory::createCastleMove
+     * The rook squares are implied by the King's from and to squares
+     */
+    template <typename ChessBoardType>
+    MoveCode createCastleMoveCode(ChessBoardType const &chessBoard, BoardSquare const &fromSquare, BoardSquare const &toSquare) {
+        return createMoveCode(chessBoard, fromSquare, toSquare, toSquare, true, false, std::nullopt);
+    }
+
+
+    MoveCode encode(BoardMove const &boardMove, ChessBoard const &chessBoard);
+    std::unique_ptr<BoardMove> decode(MoveCode moveCode, ChessBoard const &chessBoard);
+    std::string toString(MoveCode moveCode, ChessBoard const &chessBoard);
+
+    BoardSquare getFromSquare(MoveCode moveCode, int numColsOnBoard);
+    BoardSquare getToSquare(MoveCode moveCode, int numColsOnBoard);
+    BoardSquare getCaptureSquare(MoveCode moveCode, int numColsOnBoard);
+    BoardSquare getCastleRookFromSquare(MoveCode moveCode, int numColsOnBoard);
+    BoardSquare getCastleRookToSquare(MoveCode moveCode, int numColsOnBoard);
+    std::optional<PieceType> getPromotionPieceType(MoveCode moveCode);
+
+    inline int getFromSquareIndex(MoveCode moveCode) { return moveCode & 0x3FF; }
+    inline int getToSquareIndex(MoveCode moveCode) { return (moveCode >> 10) & 0x3FF; }
+    inline MoveKind getMoveKind(MoveCode moveCode) { return static_cast<MoveKind>((moveCode >> 20) & 0x03); }
+    inline bool getDoesEnableEnpassant(MoveCode moveCode) { return (moveCode >> 22) & 0x01; }
+    inline bool isPromotion(MoveCode moveCode) { return (moveCode >> 23) & 0x01; }
+    inline bool isCapture(MoveCode moveCode) { return (moveCode >> 26) & 0x01; }
+}
+
+
+#endif /* MoveCode_h */
@@ -0,0 +1,91 @@
+// MoveList.cc
+
+#include "MoveList.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "MoveCode.h"
+
+
+/*
+ * Basic ctor
+ * Inline storage is left uninitialized, only the first numMoveCodes entries are ever read
+ */
+MoveList::MoveList() :
+    numMoveCodes(0) { }
+
+/*
+ * Copy ctor
+ */
+MoveList::MoveList(MoveList const &other) :
+    overflowMoveCodes(other.overflowMoveCodes), numMoveCodes(other.numMoveCodes) {
+
+    if (numMoveCodes <= inlineCapacity) {
+        std::copy(other.inlineMoveCodes.begin(), other.inlineMoveCodes.begin() + numMoveCodes, inlineMoveCodes.begin());
+    }
+}
+
+/*
+ * Move ctor
+ */
+MoveList::MoveList(MoveList &&other) noexcept :
+    overflowMoveCodes(std::move(other.overflowMoveCodes)), numMoveCodes(other.numMoveCodes) {
+
+    if (numMoveCodes <= inlineCapacity) {
+        std::copy(other.inlineMoveCodes.begin(), other.inlineMoveCodes.begin() + numMoveCodes, inlineMoveCodes.begin());
+    }
+    other.numMoveCodes = 0;
+}
+
+/*
+ * Copy assignment
+ */
+MoveList& MoveList::operator=(MoveList const &other) {
+    if (this != &other) {
+        overflowMoveCodes = other.overflowMoveCodes;
+        numMoveCodes = other.numMoveCodes;
+        if (numMoveCodes <= inlineCapacity) {
+            std::copy(other.inlineMoveCodes.begin(), other.inlineMoveCodes.begin() + numMoveCodes, inlineMoveCodes.begin());
+        }
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+MoveList& MoveList::operator=(MoveList &&other) noexcept {
+    if (this != &other) {
+        overflowMoveCodes = std::move(other.overflowMoveCodes);
+        numMoveCodes = other.numMoveCodes;
+        if (numMoveCodes <= inlineCapacity) {
+            std::copy(other.inlineMoveCodes.begin(), other.inlineMoveCodes.begin() + numMoveCodes, inlineMoveCodes.begin());
+        }
+        other.numMoveCodes = 0;
+    }
+    return *this;
+}
+
+/*
+ * Drops every MoveCode past the first newNumMoveCodes, which must not exceed the current size
+ */
+void MoveList::truncate(int newNumMoveCodes) {
+    if (numMoveCodes > inlineCapacity) {
+        if (newNumMoveCodes <= inlineCapacity) {
+            std::copy(overflowMoveCodes.begin(), overflowMoveCodes.begin() + newNumMoveCodes, inlineMoveCodes.begin());
+            overflowMoveCodes.clear();
+        } else {
+            overflowMoveCodes.resize(newNumMoveCodes);
+        }
+    }
+    numMoveCodes = newNumMoveCodes;
+}
+
+/*
+ * Removes every MoveCode
+ */
+void MoveList::clear() {
+    truncate(0);
+}
@@ -0,0 +1,65 @@
+// MoveList.h
+
+#ifndef MoveList_h
+#define MoveList_h
+
+#include <array>
+#include <vector>
+
+#include "MoveCode.h"
+
+
+/**
+ * MoveList Class
+ * Ordered list of MoveCodes with inline storage, filled by the move generators in place of a heap allocated vector of BoardMoves
+ * - Holds up to inlineCapacity MoveCodes without allocating, several times the move count of the standard setup on a 26x26 board with Advanced Pieces
+ * - Spills every MoveCode to a heap allocated vector past that, so arbitrary user setups stay correct
+ */
+class MoveList final {
+public:
+    static int const inlineCapacity = 1024;
+
+private:
+    std::array<MoveCode, inlineCapacity> inlineMoveCodes;
+    std::vector<MoveCode> overflowMoveCodes;       // Holds every MoveCode once the size exceeds inlineCapacity
+    int numMoveCodes;
+
+public:
+    MoveList();
+    MoveList(MoveList const &other);
+    MoveList(MoveList &&other) noexcept;
+    MoveList& operator=(MoveList const &other);
+    MoveList& operator=(MoveList &&other) noexcept;
+    ~MoveList() = default;
+
+    void truncate(int newNumMoveCodes);
+    void clear();
+
+    inline void push_back(MoveCode moveCode) {
+        if (numMoveCodes < inlineCapacity) {
+            inlineMoveCodes[numMoveCodes] = moveCode;
+        } else {
+            if (numMoveCodes == inlineCapacity) {
+                overflowMoveCodes.assign(inlineMoveCodes.begin(), inlineMoveCodes.end());
+            }
+            overflowMoveCodes.push_back(moveCode);
+        }
+        ++numMoveCodes;
+    }
+
+    inline MoveCode* data() { return numMoveCodes > inlineCapacity ? overflowMoveCodes.data() : inlineMoveCodes.data(); }
+    inline MoveCode const* data() const { return numMoveCodes > inlineCapacity ? overflowMoveCodes.data() : inlineMoveCodes.data(); }
+    inline MoveCode& operator[](int index) { return data()[index]; }
+    inline MoveCode operator[](int index) const { return data()[index]; }
+
+    inline MoveCode* begin() { return data(); }
+    inline MoveCode* end() { return data() + numMoveCodes; }
+    inline MoveCode const* begin() const { return data(); }
+    inline MoveCode const* end() const { return data() + numMoveCodes; }
+
+    inline int size() const { return numMoveCodes; }
+    inline bool empty() const { return numMoveCodes == 0; }
+};
+
+
+#endif /* MoveList_h */
@@ -0,0 +1,105 @@
+// MovePicker.cc
+
+#include "MovePicker.h"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "ChessBoard.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+#include "PieceInfo.h"
+
+
+/*
+ * Basic ctor
+ * No moves are generated until the first call to next
+ */
+MovePicker::MovePicker(ChessBoard const &chessBoard, Team team, std::optional<MoveCode> hashMove) :
+    chessBoard(chessBoard), team(team), hashMove(hashMove), stage(Stage::HASH_MOVE), hasGeneratedMoves(false), nextMoveIndex(0),
+    hashMoveEnd(0), capturesEnd(0), promotionsEnd(0), quietMovesEnd(0) { }
+
+/*
+ * Generates the pseudo legal moves of the Team and orders them by Stage in place
+ */
+void MovePicker::generateMoves() {
+    hasGeneratedMoves = true;
+    chessBoard.generateAllPseudoLegalMoves(team, pseudoLegalMoves);
+
+    MoveCode *first = pseudoLegalMoves.begin();
+    MoveCode *last = pseudoLegalMoves.end();
+    if (hashMove.has_value()) {
+        MoveCode *hashMoveIt = std::find(first, last, hashMove.value());
+        if (hashMoveIt != last) {
+            std::iter_swap(first, hashMoveIt);
+            ++first;
+        }
+    }
+    hashMoveEnd = first - pseudoLegalMoves.begin();
+
+    MoveCode *capturesLast = std::partition(first, last, [](MoveCode moveCode) { return MoveCodeUtilities::isCapture(moveCode); });
+    std::sort(first, capturesLast, [this](MoveCode lhs, MoveCode rhs) { return getCaptureScore(lhs) > getCaptureScore(rhs); });
+    capturesEnd = capturesLast - pseudoLegalMoves.begin();
+
+    MoveCode *promotionsLast = std::partition(capturesLast, last, [](MoveCode moveCode) { return MoveCodeUtilities::isPromotion(moveCode); });
+    promotionsEnd = promotionsLast - pseudoLegalMoves.begin();
+
+    MoveCode *quietMovesLast = std::partition(promotionsLast, last, [](MoveCode moveCode) { return MoveCodeUtilities::getMoveKind(moveCode) != MoveKind::CASTLE; });
+    quietMovesEnd = quietMovesLast - pseudoLegalMoves.begin();
+}
+
+/*
+ * Returns the ordering score of the capturing move argument, higher for more valuable victims and then less valuable attackers
+ */
+int MovePicker::getCaptureScore(MoveCode moveCode) const {
+    int numColsOnBoard = chessBoard.getNumColsOnBoard();
+    std::optional<PieceInfo> victimInfo = chessBoard.getPieceInfoAt(MoveCodeUtilities::getCaptureSquare(moveCode, numColsOnBoard));
+    std::optional<PieceInfo> attackerInfo = chessBoard.getPieceInfoAt(MoveCodeUtilities::getFromSquare(moveCode, numColsOnBoard));
+    int victimScore = victimInfo.has_value() ? victimInfo.value().pieceScore : 0;
+    int attackerScore = attackerInfo.has_value() ? attackerInfo.value().pieceScore : 0;
+    return victimScore * 64 - attackerScore;
+}
+
+/*
+ * Returns the Stage of the move at the index argument of the ordered pseudoLegalMoves
+ */
+MovePicker::Stage MovePicker::getStageAt(int moveIndex) const {
+    if (moveIndex < hashMoveEnd) {
+        return Stage::HASH_MOVE;
+    } else if (moveIndex < capturesEnd) {
+        return Stage::CAPTURES;
+    } else if (moveIndex < promotionsEnd) {
+        return Stage::PROMOTIONS;
+    } else if (moveIndex < quietMovesEnd) {
+        return Stage::QUIET_MOVES;
+    } else if (moveIndex < pseudoLegalMoves.size()) {
+        return Stage::CASTLES;
+    }
+    return Stage::DONE;
+}
+
+/*
+ * Returns the next legal move of the Team, nullopt once all have been yielded
+ */
+std::optional<MoveCode> MovePicker::next() {
+    if (!hasGeneratedMoves) {
+        generateMoves();
+    }
+    while (nextMoveIndex < pseudoLegalMoves.size()) {
+        int moveIndex = nextMoveIndex++;
+        MoveCode moveCode = pseudoLegalMoves[moveIndex];
+        if (chessBoard.isPseudoLegalMoveLegal(moveCode)) {
+            stage = getStageAt(moveIndex);
+            return moveCode;
+        }
+    }
+    stage = Stage::DONE;
+    return std::nullopt;
+}
+
+/*
+ * Returns the Stage of the move most recently yielded by next
+ */
+MovePicker::Stage MovePicker::getStage() const { return stage; }
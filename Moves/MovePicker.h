@@ -0,0 +1,58 @@
+// MovePicker.h
+
+#ifndef MovePicker_h
+#define MovePicker_h
+
+#include <optional>
+
+#include "ChessBoard.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+
+
+/**
+ * MovePicker Class
+ * Yields the legal moves of a Team one at a time in stages, so callers that stop early skip the remaining legality tests
+ * - Pseudo legal moves are generated into inline storage on the first call to next, without allocating
+ * - Stages are yielded in order: the hash move, captures (most valuable victim first), promotions, quiet moves, castles
+ * - Each move is only checked for legality as it is yielded
+ * The ChessBoard must be back in its original position whenever next is called
+ */
+class MovePicker final {
+public:
+    enum class Stage { HASH_MOVE, CAPTURES, PROMOTIONS, QUIET_MOVES, CASTLES, DONE };
+
+private:
+    ChessBoard const &chessBoard;
+    Team team;
+    std::optional<MoveCode> hashMove;       // Yielded first if it is a legal move of the Team, ignored otherwise
+
+    Stage stage;
+    bool hasGeneratedMoves;
+    MoveList pseudoLegalMoves;
+    int nextMoveIndex;
+
+    int hashMoveEnd;        // Exclusive end index of each Stage within pseudoLegalMoves
+    int capturesEnd;
+    int promotionsEnd;
+    int quietMovesEnd;
+
+    void generateMoves();
+    int getCaptureScore(MoveCode moveCode) const;
+    Stage getStageAt(int moveIndex) const;
+
+public:
+    explicit MovePicker(ChessBoard const &chessBoard, Team team, std::optional<MoveCode> hashMove = std::nullopt);
+    MovePicker(MovePicker const &other) = delete;
+    MovePicker(MovePicker &&other) = delete;
+    MovePicker& operator=(MovePicker const &other) = delete;
+    MovePicker& operator=(MovePicker &&other) = delete;
+    ~MovePicker() = default;
+
+    std::optional<MoveCode> next();
+    Stage getStage() const;
+};
+
+
+#endif /* MovePicker_h */
@@ -15,6 +15,7 @@
 #include "Game.h"
 #include "Observer.h"
 #include "Player.h"
+#include "PositionStatus.h"
 
 
 /*
@@ -374,24 +375,24 @@ std::vector<std::u32string> TextObserver::buildBoardDataText(std::unique_ptr<Che
 std::vector<std::u32string> TextObserver::buildBoardStatusText(std::unique_ptr<ChessBoard> const &chessBoard, Team currentTurn) {
     std::u32string statusString;
     Team teamOne = chessBoard->getTeamOne();
-    Team teamTwo = chessBoard->getTeamTwo();
+    PositionStatus positionStatus = chessBoard->getPositionStatus(currentTurn);
     if (currentTurn == teamOne) { 
-        if (chessBoard->isInCheckMate(teamOne)) {
+        if (positionStatus.gameResult == GameResult::CHECKMATE) {
             statusString = std::u32string(UR"(● Checkmate! Black wins!)");
-        } else if (chessBoard->isInCheck(teamOne)) {
+        } else if (positionStatus.isInCheck) {
             statusString = std::u32string(UR"(● White is in check)");
-        } else if (chessBoard->isInStaleMate(teamOne)) {
+        } else if (positionStatus.gameResult == GameResult::STALEMATE) {
             statusString = std::u32string(UR"(● Stalemate!)");
         } else {
             statusString = std::u32string(UR"()");
         }
 
     } else {
-        if (chessBoard->isInCheckMate(teamTwo)) {
+        if (positionStatus.gameResult == GameResult::CHECKMATE) {
             statusString = std::u32string(UR"(● Checkmate! White wins!)");
-        } else if (chessBoard->isInCheck(teamTwo)) {
+        } else if (positionStatus.isInCheck) {
             statusString = std::u32string(UR"(● Black is in check)");
-        } else if (chessBoard->isInStaleMate(teamTwo)) {
+        } else if (positionStatus.gameResult == GameResult::STALEMATE) {
             statusString = std::u32string(UR"(● Stalemate!)");
         } else {
             statusString = std::u32string(UR"()");
@@ -7,12 +7,13 @@
 #include <vector>
 
 #include "Bishop.h"
-#include "BoardMove.h"
-#include "BoardMoveFactory.h"
+#include "BoardGeometry.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Piece.h"
+#include "PieceMoveGenerator.h"
 
 
 /*
@@ -54,23 +55,9 @@ AdvancedBishop& AdvancedBishop::operator=(AdvancedBishop &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for an AdvancedBishop Bishop Piece
+ * Appends all pseudo legal moves for an AdvancedBishop Bishop Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> AdvancedBishop::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    std::vector<BoardSquare> const additionalToSquares = { 
-        BoardSquare(fromSquare.boardRow + 0, fromSquare.boardCol + 1),
-        BoardSquare(fromSquare.boardRow + 0, fromSquare.boardCol - 1),
-        BoardSquare(fromSquare.boardRow + 1, fromSquare.boardCol + 0),
-        BoardSquare(fromSquare.boardRow - 1, fromSquare.boardCol + 0)
-    };
-
-    std::vector<std::unique_ptr<BoardMove>> moves = getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
-    if (chessBoard->isSquareOnBoard(fromSquare)) {
-        for (BoardSquare const &toSquare : additionalToSquares) {
-            if (chessBoard->isSquareEmpty(toSquare) || chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                moves.emplace_back(BoardMoveFactory::createStandardMove(fromSquare, toSquare, toSquare, false, pieceData, chessBoard->getPieceDataAt(toSquare)));
-            }
-        }
-    }
-    return moves;
+void AdvancedBishop::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
+    PieceMoveGenerator<ChessBoard>::addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::ORTHOGONAL_STEP, moves);
 }
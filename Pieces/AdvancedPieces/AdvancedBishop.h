@@ -7,11 +7,11 @@
 #include <vector>
 
 #include "Bishop.h"
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "ComplicatedCloneable.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -20,7 +20,7 @@
  */
 class AdvancedBishop final : public ComplicatedCloneable<Piece, Bishop, AdvancedBishop> {
 private:
-    std::vector<std::unique_ptr<BoardMove>> getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const override;
+    void addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const override;
 
 public:
     explicit AdvancedBishop(Team team, PieceDirection pieceDirection, bool hasMoved);
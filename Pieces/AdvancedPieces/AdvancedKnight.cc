@@ -6,13 +6,14 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
-#include "BoardMoveFactory.h"
+#include "BoardGeometry.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
 #include "Knight.h"
+#include "MoveList.h"
 #include "Piece.h"
+#include "PieceMoveGenerator.h"
 
 
 /*
@@ -54,27 +55,9 @@ AdvancedKnight& AdvancedKnight::operator=(AdvancedKnight &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for an AdvancedKnight Knight Piece
+ * Appends all pseudo legal moves for an AdvancedKnight Knight Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> AdvancedKnight::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    std::vector<BoardSquare> const additionalToSquares = { 
-        BoardSquare(fromSquare.boardRow + 1, fromSquare.boardCol + 3),
-        BoardSquare(fromSquare.boardRow + 1, fromSquare.boardCol - 3),
-        BoardSquare(fromSquare.boardRow - 1, fromSquare.boardCol + 3),
-        BoardSquare(fromSquare.boardRow - 1, fromSquare.boardCol - 3),
-        BoardSquare(fromSquare.boardRow + 3, fromSquare.boardCol + 1),
-        BoardSquare(fromSquare.boardRow + 3, fromSquare.boardCol - 1),
-        BoardSquare(fromSquare.boardRow - 3, fromSquare.boardCol + 1),
-        BoardSquare(fromSquare.boardRow - 3, fromSquare.boardCol - 1)
-    };
-
-    std::vector<std::unique_ptr<BoardMove>> moves = getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
-    if (chessBoard->isSquareOnBoard(fromSquare)) {
-        for (BoardSquare const &toSquare : additionalToSquares) {
-            if (chessBoard->isSquareEmpty(toSquare) || chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                moves.emplace_back(BoardMoveFactory::createStandardMove(fromSquare, toSquare, toSquare, false, pieceData, chessBoard->getPieceDataAt(toSquare)));
-            }
-        }
-    }
-    return moves;
+void AdvancedKnight::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
+    PieceMoveGenerator<ChessBoard>::addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::LONG_KNIGHT, moves);
 }
@@ -6,12 +6,12 @@
 #include <memory>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "ComplicatedCloneable.h"
 #include "Constants.h"
 #include "Knight.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -20,7 +20,7 @@
  */
 class AdvancedKnight final : public ComplicatedCloneable<Piece, Knight, AdvancedKnight> {
 private:
-    std::vector<std::unique_ptr<BoardMove>> getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const override;
+    void addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const override;
 
 public:
     explicit AdvancedKnight(Team team, PieceDirection pieceDirection, bool hasMoved);
@@ -6,14 +6,13 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
-#include "BoardMoveFactory.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
-#include "MoveDirection.h"
+#include "MoveList.h"
 #include "Pawn.h"
 #include "Piece.h"
+#include "PieceMoveGenerator.h"
 
 
 /*
@@ -55,25 +54,9 @@ AdvancedPawn& AdvancedPawn::operator=(AdvancedPawn &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for an AdvancedPawn Pawn Piece
+ * Appends all pseudo legal moves for an AdvancedPawn Pawn Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> AdvancedPawn::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    std::vector<std::unique_ptr<BoardMove>> moves = getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
-
-    // Non Attacking Moves 
-    if (!onlyAttackingMoves) {
-        int fromRow = fromSquare.boardRow;
-        int fromCol = fromSquare.boardCol;
-        MoveDirection pawnMoveDirection = getPawnMoveDirection();
-        
-        // Triple starter move
-        BoardSquare normalMoveToSquare(fromRow + pawnMoveDirection.rowDirection, fromCol + pawnMoveDirection.colDirection);
-        BoardSquare doubleMoveToSquare(fromRow + 2 * pawnMoveDirection.rowDirection, fromCol + 2 * pawnMoveDirection.colDirection);
-        BoardSquare tripleMoveToSquare(fromRow + 3 * pawnMoveDirection.rowDirection, fromCol + 3 * pawnMoveDirection.colDirection);
-        if (!pieceData.hasMoved && chessBoard->isSquareEmpty(normalMoveToSquare) && chessBoard->isSquareEmpty(doubleMoveToSquare) && chessBoard->isSquareEmpty(tripleMoveToSquare)) {
-            addMoves(moves, chessBoard, fromSquare, tripleMoveToSquare, tripleMoveToSquare, true);
-        }
-    }
-
-    return moves;
+void AdvancedPawn::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
+    PieceMoveGenerator<ChessBoard>::addAdvancedPawnMoves(chessBoard, pieceData, fromSquare, onlyAttackingMoves, moves);
 }
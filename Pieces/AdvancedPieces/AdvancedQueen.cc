@@ -6,12 +6,13 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
-#include "BoardMoveFactory.h"
+#include "BoardGeometry.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Piece.h"
+#include "PieceMoveGenerator.h"
 #include "Queen.h"
 
 
@@ -54,27 +55,9 @@ AdvancedQueen& AdvancedQueen::operator=(AdvancedQueen &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for an AdvancedQueen Queen Piece
+ * Appends all pseudo legal moves for an AdvancedQueen Queen Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> AdvancedQueen::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    std::vector<BoardSquare> const additionalToSquares = { 
-        BoardSquare(fromSquare.boardRow + 1, fromSquare.boardCol + 2),
-        BoardSquare(fromSquare.boardRow + 1, fromSquare.boardCol - 2),
-        BoardSquare(fromSquare.boardRow - 1, fromSquare.boardCol + 2),
-        BoardSquare(fromSquare.boardRow - 1, fromSquare.boardCol - 2),
-        BoardSquare(fromSquare.boardRow + 2, fromSquare.boardCol + 1),
-        BoardSquare(fromSquare.boardRow + 2, fromSquare.boardCol - 1),
-        BoardSquare(fromSquare.boardRow - 2, fromSquare.boardCol + 1),
-        BoardSquare(fromSquare.boardRow - 2, fromSquare.boardCol - 1)
-    };
-
-    std::vector<std::unique_ptr<BoardMove>> moves = getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
-    if (chessBoard->isSquareOnBoard(fromSquare)) {
-        for (BoardSquare const &toSquare : additionalToSquares) {
-            if (chessBoard->isSquareEmpty(toSquare) || chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                moves.emplace_back(BoardMoveFactory::createStandardMove(fromSquare, toSquare, toSquare, false, pieceData, chessBoard->getPieceDataAt(toSquare)));
-            }
-        }
-    }
-    return moves;
+void AdvancedQueen::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
+    PieceMoveGenerator<ChessBoard>::addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::KNIGHT, moves);
 }
@@ -7,10 +7,10 @@
 #include <vector>
 
 #include "Bishop.h"
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -53,8 +53,8 @@ BasicBishop& BasicBishop::operator=(BasicBishop &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for a BasicBishop Bishop Piece
+ * Appends all pseudo legal moves for a BasicBishop Bishop Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> BasicBishop::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    return getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
+void BasicBishop::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
 }
@@ -6,11 +6,11 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
 #include "King.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -53,8 +53,8 @@ BasicKing& BasicKing::operator=(BasicKing &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for a BasicKing King Piece
+ * Appends all pseudo legal moves for a BasicKing King Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> BasicKing::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    return getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
+void BasicKing::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
 }
@@ -6,12 +6,12 @@
 #include <memory>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "ComplicatedCloneable.h"
 #include "Constants.h"
 #include "King.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -20,7 +20,7 @@
  */
 class BasicKing final : public ComplicatedCloneable<Piece, King, BasicKing> {
 private:
-    std::vector<std::unique_ptr<BoardMove>> getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const override;
+    void addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const override;
 
 public:
     explicit BasicKing(Team team, PieceDirection pieceDirection, bool hasMoved);
@@ -6,10 +6,10 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Pawn.h"
 #include "Piece.h"
 
@@ -53,8 +53,8 @@ BasicPawn& BasicPawn::operator=(BasicPawn &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for a BasicPawn Pawn Piece
+ * Appends all pseudo legal moves for a BasicPawn Pawn Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> BasicPawn::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    return getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
+void BasicPawn::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
 }
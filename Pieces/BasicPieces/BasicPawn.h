@@ -6,11 +6,11 @@
 #include <memory>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "ComplicatedCloneable.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Pawn.h"
 #include "Piece.h"
 
@@ -20,7 +20,7 @@
  */
 class BasicPawn final : public ComplicatedCloneable<Piece, Pawn, BasicPawn> {
 private:
-    std::vector<std::unique_ptr<BoardMove>> getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const override;
+    void addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const override;
     
 public:
     explicit BasicPawn(Team team, PieceDirection pieceDirection, bool hasMoved);
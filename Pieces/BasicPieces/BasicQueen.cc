@@ -7,10 +7,10 @@
 #include <vector>
 
 #include "Bishop.h"
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Piece.h"
 #include "Queen.h"
 
@@ -54,8 +54,8 @@ BasicQueen& BasicQueen::operator=(BasicQueen &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for a BasicQueen Queen Piece
+ * Appends all pseudo legal moves for a BasicQueen Queen Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> BasicQueen::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    return getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
+void BasicQueen::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
 }
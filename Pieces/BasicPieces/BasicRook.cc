@@ -6,10 +6,10 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
+#include "MoveList.h"
 #include "Piece.h"
 #include "Rook.h"
 
@@ -53,8 +53,8 @@ BasicRook& BasicRook::operator=(BasicRook &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal moves for a BasicRook Rook Piece
+ * Appends all pseudo legal moves for a BasicRook Rook Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> BasicRook::getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    return getStandardMoves(chessBoard, fromSquare, onlyAttackingMoves);
+void BasicRook::addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    addStandardMoves(chessBoard, fromSquare, onlyAttackingMoves, moves);
 }
@@ -6,11 +6,10 @@
 #include <memory>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
-#include "MoveDirection.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -18,9 +17,6 @@
  * Abstract Bishop Piece Class
  */
 class Bishop : public Piece {
-private:
-    static std::vector<MoveDirection> const bishopMoveDirections;
-
 protected:
     explicit Bishop(PieceLevel pieceLevel, Team team, PieceDirection pieceDirection, bool hasMoved, char32_t image);
     Bishop(Bishop const &other);
@@ -29,7 +25,7 @@ protected:
     Bishop& operator=(Bishop &&other) noexcept;
     virtual ~Bishop() = default;
 
-    std::vector<std::unique_ptr<BoardMove>> getStandardMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const override;
+    void addStandardMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const override;
 };
 
 
@@ -6,31 +6,15 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
-#include "BoardMoveFactory.h"
+#include "BoardGeometry.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
-#include "MoveDirection.h"
+#include "MoveList.h"
 #include "Piece.h"
+#include "PieceMoveGenerator.h"
 
 
-/*
- * Static
- *
- * The directions a Knight Piece can move
- */
-std::vector<MoveDirection> const Knight::knightMoveDirections = { 
-    { MoveDirection(-1, -2) }, 
-    { MoveDirection(-1, 2) }, 
-    { MoveDirection(1, -2) }, 
-    { MoveDirection(1, 2) }, 
-    { MoveDirection(-2, -1) }, 
-    { MoveDirection(-2, 1) }, 
-    { MoveDirection(2, -1) }, 
-    { MoveDirection(2, 1) } 
-};
-
 /*
  * Basic ctor
  */
@@ -70,17 +54,8 @@ Knight& Knight::operator=(Knight &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal standard moves for a Knight Piece
+ * Appends all pseudo legal standard moves for a Knight Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> Knight::getStandardMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    std::vector<std::unique_ptr<BoardMove>> moves;
-    if (chessBoard->isSquareOnBoard(fromSquare)) {
-        for (MoveDirection const &knightMoveDirection : knightMoveDirections) {
-            BoardSquare toSquare(fromSquare.boardRow + knightMoveDirection.rowDirection, fromSquare.boardCol + knightMoveDirection.colDirection);
-            if (chessBoard->isSquareEmpty(toSquare) || chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                moves.emplace_back(BoardMoveFactory::createStandardMove(fromSquare, toSquare, toSquare, false, pieceData, chessBoard->getPieceDataAt(toSquare)));
-            }
-        }
-    }
-    return moves;
+void Knight::addStandardMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    PieceMoveGenerator<ChessBoard>::addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::KNIGHT, moves);
 }
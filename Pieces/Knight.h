@@ -6,11 +6,10 @@
 #include <memory>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
-#include "MoveDirection.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -18,9 +17,6 @@
  * Abstract Knight Piece Class
  */
 class Knight : public Piece {
-private:
-    static std::vector<MoveDirection> const knightMoveDirections;
-
 protected:
     explicit Knight(PieceLevel pieceLevel, Team team, PieceDirection pieceDirection, bool hasMoved, char32_t image);
     Knight(Knight const &other);
@@ -29,7 +25,7 @@ protected:
     Knight& operator=(Knight &&other) noexcept;
     virtual ~Knight() = default;
 
-    std::vector<std::unique_ptr<BoardMove>> getStandardMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const override;
+    void addStandardMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const override;
 };
 
 
@@ -10,7 +10,7 @@
 #include "PieceInfo.h"
 #include "ChessBoard.h"
 #include "BoardSquare.h"
-#include "BoardMove.h"
+#include "MoveList.h"
 
 
 /*
@@ -70,7 +70,7 @@ bool Piece::operator!=(Piece const &other) const {
 }
 
 /* Public Virtual Methods */
-std::vector<std::unique_ptr<BoardMove>> Piece::getMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const { return getMovesImpl(chessBoard, fromSquare, onlyAttackingMoves); }
+void Piece::addMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const { addMovesImpl(chessBoard, fromSquare, onlyAttackingMoves, moves); }
 std::unique_ptr<Piece> Piece::clone() const { return cloneImpl(); }
 
 /* Getters */
@@ -10,7 +10,7 @@
 #include "PieceInfo.h"
 #include "ChessBoard.h"
 #include "BoardSquare.h"
-#include "BoardMove.h"
+#include "MoveList.h"
 
 
 /**
@@ -19,9 +19,9 @@
  */
 class Piece {
 private:
-    virtual std::vector<std::unique_ptr<BoardMove>> getStandardMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const = 0;
+    virtual void addStandardMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const = 0;
 
-    virtual std::vector<std::unique_ptr<BoardMove>> getMovesImpl(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const = 0;
+    virtual void addMovesImpl(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const = 0;
     virtual std::unique_ptr<Piece> cloneImpl() const = 0;
     
 protected:
@@ -40,7 +40,7 @@ public:
     bool operator==(Piece const &other) const;
     bool operator!=(Piece const &other) const;
 
-    std::vector<std::unique_ptr<BoardMove>> getMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const;
+    void addMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const;
     std::unique_ptr<Piece> clone() const;
     
     PieceData const& getPieceData() const;
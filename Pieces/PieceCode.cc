@@ -0,0 +1,27 @@
+// PieceCode.cc
+
+#include "PieceCode.h"
+
+#include "Constants.h"
+#include "PieceData.h"
+
+
+/*
+ * Returns the PieceCode representing the PieceData argument
+ */
+PieceCode PieceCodeUtilities::encode(PieceData const &pieceData) {
+    return static_cast<PieceCode>(
+        (static_cast<int>(pieceData.pieceType) + 1) |
+        (static_cast<int>(pieceData.pieceLevel) << 3) |
+        (static_cast<int>(pieceData.team) << 4) |
+        (static_cast<int>(pieceData.pieceDirection) << 5) |
+        (static_cast<int>(pieceData.hasMoved) << 7));
+}
+
+/*
+ * Returns the PieceData represented by the PieceCode argument
+ * PieceCode argument must represent a Piece (not empty or off board)
+ */
+PieceData PieceCodeUtilities::decode(PieceCode pieceCode) {
+    return PieceData(getPieceType(pieceCode), getPieceLevel(pieceCode), getTeam(pieceCode), getPieceDirection(pieceCode), getHasMoved(pieceCode));
+}
@@ -0,0 +1,60 @@
+// PieceCode.h
+
+#ifndef PieceCode_h
+#define PieceCode_h
+
+#include <cstdint>
+
+#include "Constants.h"
+#include "PieceData.h"
+
+
+/**
+ * PieceCode
+ * Compact single byte encoding of a PieceData, used as the backing store of a ChessBoard square
+ * - Bits 0-2: PieceType + 1 (0 for an empty square, 7 for an off board square)
+ * - Bit 3:    PieceLevel
+ * - Bit 4:    Team
+ * - Bits 5-6: PieceDirection
+ * - Bit 7:    hasMoved
+ */
+using PieceCode = std::uint8_t;
+
+/*
+ * The PieceCode of a square on the ChessBoard with no Piece on it
+ */
+static PieceCode const EMPTY_PIECE_CODE = 0;
+
+/*
+ * The PieceCode of a sentinel square bordering the ChessBoard
+ */
+static PieceCode const OFF_BOARD_PIECE_CODE = 7;
+
+
+/**
+ * Utility methods that operate on PieceCodes
+ */
+namespace PieceCodeUtilities {
+    PieceCode encode(PieceData const &pieceData);
+    PieceData decode(PieceCode pieceCode);
+
+    inline bool isPiece(PieceCode pieceCode) { return static_cast<unsigned int>((pieceCode & 0x07) - 1) < 6; }
+    inline PieceType getPieceType(PieceCode pieceCode) { return static_cast<PieceType>((pieceCode & 0x07) - 1); }
+    inline PieceLevel getPieceLevel(PieceCode pieceCode) { return static_cast<PieceLevel>((pieceCode >> 3) & 0x01); }
+    inline Team getTeam(PieceCode pieceCode) { return static_cast<Team>((pieceCode >> 4) & 0x01); }
+    inline PieceDirection getPieceDirection(PieceCode pieceCode) { return static_cast<PieceDirection>((pieceCode >> 5) & 0x03); }
+    inline bool getHasMoved(PieceCode pieceCode) { return (pieceCode >> 7) & 0x01; }
+
+    inline PieceCode withPieceType(PieceCode pieceCode, PieceType pieceType) { return static_cast<PieceCode>((pieceCode & ~0x07) | (static_cast<int>(pieceType) + 1)); }
+    inline PieceCode withHasMoved(PieceCode pieceCode, bool hasMoved) { return static_cast<PieceCode>((pieceCode & 0x7F) | (static_cast<int>(hasMoved) << 7)); }
+
+    inline bool isPieceOf(PieceCode pieceCode, Team team, PieceType pieceType) { 
+        return (pieceCode & 0x17) == ((static_cast<int>(pieceType) + 1) | (static_cast<int>(team) << 4)); 
+    }
+    inline bool isPieceOf(PieceCode pieceCode, Team team, PieceType pieceType, PieceLevel pieceLevel) { 
+        return (pieceCode & 0x1F) == ((static_cast<int>(pieceType) + 1) | (static_cast<int>(pieceLevel) << 3) | (static_cast<int>(team) << 4)); 
+    }
+}
+
+
+#endif /* PieceCode_h */
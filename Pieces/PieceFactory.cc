@@ -2,19 +2,21 @@
 
 #include "PieceFactory.h"
 
+#include <array>
 #include <cassert>
 #include <memory>
 
 #include "AdvancedPieceFactory.h"
 #include "BasicPieceFactory.h"
 #include "Piece.h"
+#include "PieceCode.h"
 #include "PieceData.h"
 
 
 /*
  * Static
  *
- * Returns a Piece instance
+ * Returns a new Piece instance
  */
 std::unique_ptr<Piece> PieceFactory::createPiece(PieceData const &pieceData) {
     switch (pieceData.pieceLevel) {
@@ -26,3 +28,31 @@ std::unique_ptr<Piece> PieceFactory::createPiece(PieceData const &pieceData) {
             assert(false);
     }
 }
+
+/*
+ * Static
+ *
+ * Returns the shared Piece instance for the PieceData argument
+ */
+Piece const& PieceFactory::getPiece(PieceData const &pieceData) {
+    return getPiece(PieceCodeUtilities::encode(pieceData));
+}
+
+/*
+ * Static
+ *
+ * Returns the shared Piece instance for the PieceCode argument, which must represent a Piece
+ * Every instance is built together on the first call, which is thread safe
+ */
+Piece const& PieceFactory::getPiece(PieceCode pieceCode) {
+    static std::array<std::unique_ptr<Piece const>, 256> const pieces = []() {
+        std::array<std::unique_ptr<Piece const>, 256> pieces;
+        for (int pieceCode = 0; pieceCode < 256; ++pieceCode) {
+            if (PieceCodeUtilities::isPiece(pieceCode)) {
+                pieces[pieceCode] = createPiece(PieceCodeUtilities::decode(pieceCode));
+            }
+        }
+        return pieces;
+    }();
+    return *pieces[pieceCode];
+}
@@ -6,16 +6,22 @@
 #include <memory>
 
 #include "Piece.h"
+#include "PieceCode.h"
 #include "PieceData.h"
 
 
 /**
- * Factory for creating Piece instances
+ * Factory for Piece instances
+ * Pieces are immutable flyweights: one shared instance exists per distinct PieceData, built on first use and never destroyed
  */
 class PieceFactory final {
-public:
+private:
     static std::unique_ptr<Piece> createPiece(PieceData const &pieceData);
+
+public:
+    static Piece const& getPiece(PieceData const &pieceData);
+    static Piece const& getPiece(PieceCode pieceCode);
 };
 
 
-#endif /* PieceFactory_u */
+#endif /* PieceFactory_h */
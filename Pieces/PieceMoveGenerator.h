@@ -0,0 +1,484 @@
+// PieceMoveGenerator.h
+
+#ifndef PieceMoveGenerator_h
+#define PieceMoveGenerator_h
+
+#include <cassert>
+#include <cstdlib>
+#include <optional>
+#include <vector>
+
+#include "BoardGeometry.h"
+#include "BoardSquare.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveDirection.h"
+#include "MoveList.h"
+#include "PieceData.h"
+
+
+/**
+ * PieceMoveGenerator Class
+ * Pseudo legal move generation for every PieceType and PieceLevel, templated over the ChessBoard that is probed
+ * - Instantiated against ChessBoard by the Piece classes, every square probe is a virtual call
+ * - Instantiated against a StaticChessBoard implementation in its own translation unit, every square probe can be inlined
+ * An ADVANCED Piece generates the moves of its BASIC counterpart followed by its additional moves
+ */
+template <typename ChessBoardType>
+class PieceMoveGenerator final {
+private:
+    static std::vector<PieceType> const promotionPieceTypes;
+    static std::vector<MoveDirection> const bishopMoveDirections;
+    static std::vector<MoveDirection> const rookMoveDirections;
+    static std::vector<MoveDirection> const queenMoveDirections;
+
+    static MoveDirection getPawnMoveDirection(PieceDirection pieceDirection);
+    static void addPawnMove(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, BoardSquare const &toSquare, BoardSquare const &captureSquare, bool doesEnableEnpassant, MoveList &moves);
+    static bool canCastle(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, BoardSquare const &toSquare, BoardSquare const &rookFromSquare, BoardSquare const &rookToSquare);
+
+public:
+    PieceMoveGenerator() = delete;
+
+    static void addMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves);
+
+    static void addLeaperMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, BoardGeometry::LeaperPattern leaperPattern, MoveList &moves);
+    static void addSliderMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, std::vector<MoveDirection> const &moveDirections, MoveList &moves);
+
+    static void addPawnMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves);
+    static void addAdvancedPawnMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves);
+    static void addBishopMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, MoveList &moves);
+    static void addRookMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, MoveList &moves);
+    static void addQueenMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, MoveList &moves);
+    static void addKingMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves);
+};
+
+
+/*
+ * Static
+ *
+ * The PieceTypes a Pawn can promote to, in the order their moves are generated
+ */
+template <typename ChessBoardType>
+std::vector<PieceType> const PieceMoveGenerator<ChessBoardType>::promotionPieceTypes = { PieceType::QUEEN, PieceType::ROOK, PieceType::KNIGHT, PieceType::BISHOP };
+
+/*
+ * Static
+ *
+ * The directions a Bishop Piece can move
+ */
+template <typename ChessBoardType>
+std::vector<MoveDirection> const PieceMoveGenerator<ChessBoardType>::bishopMoveDirections = {
+    { MoveDirection(-1, -1) },
+    { MoveDirection(-1,  1) },
+    { MoveDirection(1, -1) },
+    { MoveDirection(1,  1) }
+};
+
+/*
+ * Static
+ *
+ * The directions a Rook Piece can move
+ */
+template <typename ChessBoardType>
+std::vector<MoveDirection> const PieceMoveGenerator<ChessBoardType>::rookMoveDirections = {
+    { MoveDirection(-1, 0) },
+    { MoveDirection(0, -1) },
+    { MoveDirection(0, 1) },
+    { MoveDirection(1, 0) },
+};
+
+/*
+ * Static
+ *
+ * The directions a Queen Piece can move
+ */
+template <typename ChessBoardType>
+std::vector<MoveDirection> const PieceMoveGenerator<ChessBoardType>::queenMoveDirections = {
+    { MoveDirection(-1, -1) },
+    { MoveDirection(-1, 0) },
+    { MoveDirection(-1, 1) },
+    { MoveDirection(0, -1) },
+    { MoveDirection(0, 1) },
+    { MoveDirection(1, -1) },
+    { MoveDirection(1, 0) },
+    { MoveDirection(1, 1) }
+};
+
+/*
+ * Static
+ *
+ * Appends all pseudo legal moves of the Piece described by the PieceData argument to the MoveList argument
+ * onlyAttackingMoves: if true, do not generate any moves that are non-capturing moves (castling)
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) {
+    bool isAdvanced = pieceData.pieceLevel == PieceLevel::ADVANCED;
+    switch (pieceData.pieceType) {
+        case PieceType::PAWN:
+            addPawnMoves(chessBoard, pieceData, fromSquare, onlyAttackingMoves, moves);
+            if (isAdvanced) {
+                addAdvancedPawnMoves(chessBoard, pieceData, fromSquare, onlyAttackingMoves, moves);
+            }
+            break;
+        case PieceType::KNIGHT:
+            addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::KNIGHT, moves);
+            if (isAdvanced) {
+                addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::LONG_KNIGHT, moves);
+            }
+            break;
+        case PieceType::BISHOP:
+            addBishopMoves(chessBoard, pieceData, fromSquare, moves);
+            if (isAdvanced) {
+                addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::ORTHOGONAL_STEP, moves);
+            }
+            break;
+        case PieceType::ROOK:
+            addRookMoves(chessBoard, pieceData, fromSquare, moves);
+            if (isAdvanced) {
+                addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::DIAGONAL_STEP, moves);
+            }
+            break;
+        case PieceType::QUEEN:
+            addQueenMoves(chessBoard, pieceData, fromSquare, moves);
+            if (isAdvanced) {
+                addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::KNIGHT, moves);
+            }
+            break;
+        case PieceType::KING:
+            addKingMoves(chessBoard, pieceData, fromSquare, onlyAttackingMoves, moves);
+            if (isAdvanced) {
+                addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::DIAGONAL_JUMP, moves);
+            }
+            break;
+        default:
+            assert(false);
+    }
+}
+
+/*
+ * Static
+ *
+ * Appends a move to every target of the LeaperPattern argument that is empty or holds a Piece of the other Team to the MoveList argument
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addLeaperMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, BoardGeometry::LeaperPattern leaperPattern, MoveList &moves) {
+    if (chessBoard.isSquareOnBoard(fromSquare)) {
+        for (BoardSquare const &toSquare : chessBoard.getBoardGeometry().getLeaperTargets(fromSquare, leaperPattern)) {
+            if (chessBoard.isSquareEmpty(toSquare) || chessBoard.isSquareOtherTeam(toSquare, pieceData.team)) {
+                moves.push_back(MoveCodeUtilities::createStandardMoveCode(chessBoard, fromSquare, toSquare, toSquare, false));
+            }
+        }
+    }
+}
+
+/*
+ * Static
+ *
+ * Appends a move to every square along each of the MoveDirection arguments to the MoveList argument
+ * Each ray stops at its first occupied square, which is included if it holds a Piece of the other Team
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addSliderMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, std::vector<MoveDirection> const &moveDirections, MoveList &moves) {
+    if (chessBoard.isSquareOnBoard(fromSquare)) {
+        BoardGeometry const &boardGeometry = chessBoard.getBoardGeometry();
+        for (MoveDirection const &moveDirection : moveDirections) {
+            for (BoardSquare const &toSquare : boardGeometry.getRay(fromSquare, moveDirection)) {
+                if (chessBoard.isSquareEmpty(toSquare)) {
+                    moves.push_back(MoveCodeUtilities::createStandardMoveCode(chessBoard, fromSquare, toSquare, toSquare, false));
+                    continue;
+                }
+                if (chessBoard.isSquareOtherTeam(toSquare, pieceData.team)) {
+                    moves.push_back(MoveCodeUtilities::createStandardMoveCode(chessBoard, fromSquare, toSquare, toSquare, false));
+                }
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * Static
+ *
+ * Returns the direction a Pawn facing the PieceDirection argument moves in
+ */
+template <typename ChessBoardType>
+MoveDirection PieceMoveGenerator<ChessBoardType>::getPawnMoveDirection(PieceDirection pieceDirection) {
+    switch (pieceDirection) {
+        case PieceDirection::NORTH: return MoveDirection(-1, 0);
+        case PieceDirection::SOUTH: return MoveDirection(1, 0);
+        case PieceDirection::EAST: return MoveDirection(0, 1);
+        case PieceDirection::WEST: return MoveDirection(0, -1);
+        default:
+            assert(false);
+            return MoveDirection(0, 0);
+    }
+}
+
+/*
+ * Static
+ *
+ * Appends the Pawn move represented by the arguments to the MoveList argument, as one move per promotion PieceType if it reaches the far edge
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addPawnMove(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, BoardSquare const &toSquare, BoardSquare const &captureSquare, bool doesEnableEnpassant, MoveList &moves) {
+    PieceDirection pieceDirection = pieceData.pieceDirection;
+    int toRow = toSquare.boardRow;
+    int toCol = toSquare.boardCol;
+
+    if ((pieceDirection == PieceDirection::NORTH && toRow == 0) ||
+        (pieceDirection == PieceDirection::SOUTH && toRow == chessBoard.getNumRowsOnBoard() - 1) ||
+        (pieceDirection == PieceDirection::EAST && toCol == chessBoard.getNumColsOnBoard() - 1) ||
+        (pieceDirection == PieceDirection::WEST && toCol == 0)) {
+
+        for (PieceType const &promotionPieceType : promotionPieceTypes) {
+            moves.push_back(MoveCodeUtilities::createPromotionMoveCode(chessBoard, fromSquare, toSquare, captureSquare, promotionPieceType, doesEnableEnpassant));
+        }
+    } else {
+        moves.push_back(MoveCodeUtilities::createStandardMoveCode(chessBoard, fromSquare, toSquare, captureSquare, doesEnableEnpassant));
+    }
+}
+
+/*
+ * Static
+ *
+ * Appends all pseudo legal standard moves for a Pawn Piece to the MoveList argument
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addPawnMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) {
+    if (chessBoard.isSquareOnBoard(fromSquare)) {
+        int fromRow = fromSquare.boardRow;
+        int fromCol = fromSquare.boardCol;
+        MoveDirection pawnMoveDirection = getPawnMoveDirection(pieceData.pieceDirection);
+
+        // Non Attacking Moves
+        if (!onlyAttackingMoves) {
+
+            // Normal Move + Double Pawn
+            BoardSquare normalMoveToSquare(fromRow + pawnMoveDirection.rowDirection, fromCol + pawnMoveDirection.colDirection);
+            BoardSquare doubleMoveToSquare(fromRow + 2 * pawnMoveDirection.rowDirection, fromCol + 2 * pawnMoveDirection.colDirection);
+            if (chessBoard.isSquareEmpty(normalMoveToSquare)) {
+                addPawnMove(chessBoard, pieceData, fromSquare, normalMoveToSquare, normalMoveToSquare, false, moves);
+                if (!pieceData.hasMoved && chessBoard.isSquareEmpty(doubleMoveToSquare)) {
+                    addPawnMove(chessBoard, pieceData, fromSquare, doubleMoveToSquare, doubleMoveToSquare, true, moves);
+                }
+            }
+        }
+
+        // En Passant
+        std::optional<BoardSquare> enPassantSquare = chessBoard.getEnPassantSquare();
+        if (enPassantSquare.has_value() && chessBoard.isSquareOtherTeam(enPassantSquare.value(), pieceData.team)) {
+            int lastMoveToRow = enPassantSquare.value().boardRow;
+            int lastMoveToCol = enPassantSquare.value().boardCol;
+
+            switch (pieceData.pieceDirection) {
+                case PieceDirection::NORTH:
+                case PieceDirection::SOUTH: {
+                    if (lastMoveToRow == fromRow && std::abs(lastMoveToCol - fromCol) == 1) {
+                        BoardSquare toSquare(fromRow + pawnMoveDirection.rowDirection, lastMoveToCol);
+                        if (chessBoard.isSquareOnBoard(toSquare)) {
+                            addPawnMove(chessBoard, pieceData, fromSquare, toSquare, enPassantSquare.value(), false, moves);
+                        }
+                    }
+                    break;
+                }
+                case PieceDirection::EAST:
+                case PieceDirection::WEST: {
+                    if (lastMoveToCol == fromCol && std::abs(lastMoveToRow - fromRow) == 1) {
+                        BoardSquare toSquare(lastMoveToRow, fromCol + pawnMoveDirection.colDirection);
+                        if (chessBoard.isSquareOnBoard(toSquare)) {
+                            addPawnMove(chessBoard, pieceData, fromSquare, toSquare, enPassantSquare.value(), false, moves);
+                        }
+                    }
+                    break;
+                }
+                default:
+                    assert(false);
+            }
+        }
+
+        // Attack
+        switch (pieceData.pieceDirection) {
+            case PieceDirection::NORTH:
+            case PieceDirection::SOUTH: {
+                BoardSquare leftToSquare(fromRow + pawnMoveDirection.rowDirection, fromCol - 1);
+                BoardSquare rightToSquare(fromRow + pawnMoveDirection.rowDirection, fromCol + 1);
+                if (chessBoard.isSquareOtherTeam(leftToSquare, pieceData.team)) {
+                    addPawnMove(chessBoard, pieceData, fromSquare, leftToSquare, leftToSquare, false, moves);
+                }
+                if (chessBoard.isSquareOtherTeam(rightToSquare, pieceData.team)) {
+                    addPawnMove(chessBoard, pieceData, fromSquare, rightToSquare, rightToSquare, false, moves);
+                }
+                break;
+            }
+            case PieceDirection::EAST:
+            case PieceDirection::WEST: {
+                BoardSquare upToSquare(fromRow - 1, fromCol + pawnMoveDirection.colDirection);
+                BoardSquare downToSquare(fromRow + 1, fromCol + pawnMoveDirection.colDirection);
+                if (chessBoard.isSquareOtherTeam(upToSquare, pieceData.team)) {
+                    addPawnMove(chessBoard, pieceData, fromSquare, upToSquare, upToSquare, false, moves);
+                }
+                if (chessBoard.isSquareOtherTeam(downToSquare, pieceData.team)) {
+                    addPawnMove(chessBoard, pieceData, fromSquare, downToSquare, downToSquare, false, moves);
+                }
+                break;
+            }
+            default:
+                assert(false);
+        }
+    }
+}
+
+/*
+ * Static
+ *
+ * Appends the moves an ADVANCED Pawn Piece makes on top of the standard Pawn moves to the MoveList argument (the triple starter move)
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addAdvancedPawnMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) {
+    if (!onlyAttackingMoves) {
+        int fromRow = fromSquare.boardRow;
+        int fromCol = fromSquare.boardCol;
+        MoveDirection pawnMoveDirection = getPawnMoveDirection(pieceData.pieceDirection);
+
+        BoardSquare normalMoveToSquare(fromRow + pawnMoveDirection.rowDirection, fromCol + pawnMoveDirection.colDirection);
+        BoardSquare doubleMoveToSquare(fromRow + 2 * pawnMoveDirection.rowDirection, fromCol + 2 * pawnMoveDirection.colDirection);
+        BoardSquare tripleMoveToSquare(fromRow + 3 * pawnMoveDirection.rowDirection, fromCol + 3 * pawnMoveDirection.colDirection);
+        if (!pieceData.hasMoved && chessBoard.isSquareEmpty(normalMoveToSquare) && chessBoard.isSquareEmpty(doubleMoveToSquare) && chessBoard.isSquareEmpty(tripleMoveToSquare)) {
+            addPawnMove(chessBoard, pieceData, fromSquare, tripleMoveToSquare, tripleMoveToSquare, true, moves);
+        }
+    }
+}
+
+/*
+ * Static
+ *
+ * Appends all pseudo legal standard moves for a Bishop Piece to the MoveList argument
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addBishopMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, MoveList &moves) {
+    addSliderMoves(chessBoard, pieceData, fromSquare, bishopMoveDirections, moves);
+}
+
+/*
+ * Static
+ *
+ * Appends all pseudo legal standard moves for a Rook Piece to the MoveList argument
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addRookMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, MoveList &moves) {
+    addSliderMoves(chessBoard, pieceData, fromSquare, rookMoveDirections, moves);
+}
+
+/*
+ * Static
+ *
+ * Appends all pseudo legal standard moves for a Queen Piece to the MoveList argument
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addQueenMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, MoveList &moves) {
+    addSliderMoves(chessBoard, pieceData, fromSquare, queenMoveDirections, moves);
+}
+
+/*
+ * Static
+ *
+ * Appends all pseudo legal standard moves for a King Piece to the MoveList argument, including castles unless onlyAttackingMoves
+ */
+template <typename ChessBoardType>
+void PieceMoveGenerator<ChessBoardType>::addKingMoves(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) {
+    if (chessBoard.isSquareOnBoard(fromSquare)) {
+        int fromRow = fromSquare.boardRow;
+        int fromCol = fromSquare.boardCol;
+
+        // Standard Moves
+        addLeaperMoves(chessBoard, pieceData, fromSquare, BoardGeometry::LeaperPattern::KING, moves);
+
+        // Non Attacking Moves
+        if (!onlyAttackingMoves) {
+
+            // Castle
+            if (!pieceData.hasMoved && !chessBoard.isSquareAttacked(fromSquare, pieceData.team)) {
+                switch (pieceData.pieceDirection) {
+                    case PieceDirection::NORTH:
+                    case PieceDirection::SOUTH: {
+                        if (fromRow == 0 || fromRow == chessBoard.getNumRowsOnBoard() - 1) {
+
+                            // Left Castle: Check if have enough room to the left and that the rook travel square is empty
+                            if (fromCol >= 4 && chessBoard.isSquareEmpty(BoardSquare(fromRow, fromCol - 3))) {
+                                BoardSquare rookFromSquare(fromRow, fromCol - 4);
+                                BoardSquare toSquare(fromRow, fromCol - 2);
+                                BoardSquare rookToSquare(fromRow, fromCol - 1);
+                                if (canCastle(chessBoard, pieceData, fromSquare, toSquare, rookFromSquare, rookToSquare)) {
+                                    moves.push_back(MoveCodeUtilities::createCastleMoveCode(chessBoard, fromSquare, toSquare));
+                                }
+                            }
+
+                            // Right Castle: Check if have enough room to the right
+                            if (fromCol <= chessBoard.getNumColsOnBoard() - 4) {
+                                BoardSquare rookFromSquare(fromRow, fromCol + 3);
+                                BoardSquare toSquare(fromRow, fromCol + 2);
+                                BoardSquare rookToSquare(fromRow, fromCol + 1);
+                                if (canCastle(chessBoard, pieceData, fromSquare, toSquare, rookFromSquare, rookToSquare)) {
+                                    moves.push_back(MoveCodeUtilities::createCastleMoveCode(chessBoard, fromSquare, toSquare));
+                                }
+                            }
+                        }
+                        break;
+                    }
+                    case PieceDirection::EAST:
+                    case PieceDirection::WEST: {
+                        if (fromCol == 0 || fromCol == chessBoard.getNumColsOnBoard() - 1) {
+
+                            // Up Castle: Check if we have enough room up and that the rook travel square is empty
+                            if (fromRow >= 4 && chessBoard.isSquareEmpty(BoardSquare(fromRow - 3, fromCol))) {
+                                BoardSquare rookFromSquare(fromRow - 4, fromCol);
+                                BoardSquare toSquare(fromRow - 2, fromCol);
+                                BoardSquare rookToSquare(fromRow - 1, fromCol);
+                                if (canCastle(chessBoard, pieceData, fromSquare, toSquare, rookFromSquare, rookToSquare)) {
+                                    moves.push_back(MoveCodeUtilities::createCastleMoveCode(chessBoard, fromSquare, toSquare));
+                                }
+                            }
+
+                            // Down Castle: Check if have enough room down
+                            if (fromRow <= chessBoard.getNumRowsOnBoard() - 4) {
+                                BoardSquare rookFromSquare(fromRow + 3, fromCol);
+                                BoardSquare toSquare(fromRow + 2, fromCol);
+                                BoardSquare rookToSquare(fromRow + 1, fromCol);
+                                if (canCastle(chessBoard, pieceData, fromSquare, toSquare, rookFromSquare, rookToSquare)) {
+                                    moves.push_back(MoveCodeUtilities::createCastleMoveCode(chessBoard, fromSquare, toSquare));
+                                }
+                            }
+                        }
+                        break;
+                    }
+                    default:
+                        assert(false);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Static
+ *
+ * True if a Castle move is legal, false otherwise
+ */
+template <typename ChessBoardType>
+bool PieceMoveGenerator<ChessBoardType>::canCastle(ChessBoardType const &chessBoard, PieceData const &pieceData, BoardSquare const &fromSquare, BoardSquare const &toSquare, BoardSquare const &rookFromSquare, BoardSquare const &rookToSquare) {
+    std::optional<PieceData> potentialRookPieceData = chessBoard.getPieceDataAt(rookFromSquare);
+    if (potentialRookPieceData.has_value()) {
+        return
+            potentialRookPieceData.value().pieceType == PieceType::ROOK &&
+            potentialRookPieceData.value().team == pieceData.team &&
+            potentialRookPieceData.value().pieceDirection == pieceData.pieceDirection &&
+            potentialRookPieceData.value().hasMoved == false &&
+            chessBoard.isSquareEmpty(toSquare) &&
+            chessBoard.isSquareEmpty(rookToSquare) && !chessBoard.isSquareAttacked(rookToSquare, pieceData.team);
+    }
+
+    return false;
+}
+
+
+#endif /* PieceMoveGenerator_h */
@@ -6,31 +6,15 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
-#include "BoardMoveFactory.h"
+#include "BoardGeometry.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
-#include "MoveDirection.h"
+#include "MoveList.h"
 #include "Piece.h"
+#include "PieceMoveGenerator.h"
 
 
-/*
- * Static
- *
- * The directions a Queen Piece can move
- */
-std::vector<MoveDirection> const Queen::queenMoveDirections = { 
-    { MoveDirection(-1, -1) }, 
-    { MoveDirection(-1, 0) }, 
-    { MoveDirection(-1, 1) }, 
-    { MoveDirection(0, -1) }, 
-    { MoveDirection(0, 1) }, 
-    { MoveDirection(1, -1) }, 
-    { MoveDirection(1, 0) }, 
-    { MoveDirection(1, 1) } 
-};
-
 /*
  * Basic ctor
  */
@@ -70,22 +54,8 @@ Queen& Queen::operator=(Queen &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal standard moves for a Queen Piece
+ * Appends all pseudo legal standard moves for a Queen Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> Queen::getStandardMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    std::vector<std::unique_ptr<BoardMove>> moves;
-    if (chessBoard->isSquareOnBoard(fromSquare)) {
-        for (MoveDirection const &queenMoveDirection : queenMoveDirections) {
-            BoardSquare toSquare(fromSquare.boardRow + queenMoveDirection.rowDirection, fromSquare.boardCol + queenMoveDirection.colDirection);
-            while (chessBoard->isSquareEmpty(toSquare) || chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                moves.emplace_back(BoardMoveFactory::createStandardMove(fromSquare, toSquare, toSquare, false, pieceData, chessBoard->getPieceDataAt(toSquare)));
-                if (chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                    break;
-                }
-                toSquare.boardRow += queenMoveDirection.rowDirection;
-                toSquare.boardCol += queenMoveDirection.colDirection;
-            }
-        }
-    }
-    return moves;
+void Queen::addStandardMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    PieceMoveGenerator<ChessBoard>::addQueenMoves(chessBoard, pieceData, fromSquare, moves);
 }
@@ -6,11 +6,10 @@
 #include <memory>
 #include <vector>
 
-#include "BoardMove.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
-#include "MoveDirection.h"
+#include "MoveList.h"
 #include "Piece.h"
 
 
@@ -18,9 +17,6 @@
  * Abstract Queen Piece Class
  */
 class Queen : public Piece {
-private:
-    static std::vector<MoveDirection> const queenMoveDirections;
-
 protected:
     explicit Queen(PieceLevel pieceLevel, Team team, PieceDirection pieceDirection, bool hasMoved, char32_t image);
     Queen(Queen const &other);
@@ -29,7 +25,7 @@ protected:
     Queen& operator=(Queen &&other) noexcept;
     virtual ~Queen() = default;
 
-    std::vector<std::unique_ptr<BoardMove>> getStandardMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const override;
+    void addStandardMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const override;
 };
 
 
@@ -6,27 +6,15 @@
 #include <utility>
 #include <vector>
 
-#include "BoardMove.h"
-#include "BoardMoveFactory.h"
+#include "BoardGeometry.h"
 #include "BoardSquare.h"
 #include "ChessBoard.h"
 #include "Constants.h"
-#include "MoveDirection.h"
+#include "MoveList.h"
 #include "Piece.h"
+#include "PieceMoveGenerator.h"
 
 
-/*
- * Static
- *
- * The directions a Bishop Piece can move
- */
-std::vector<MoveDirection> const Rook::rookMoveDirections = { 
-    { MoveDirection(-1, 0) }, 
-    { MoveDirection(0, -1) }, 
-    { MoveDirection(0, 1) }, 
-    { MoveDirection(1, 0) }, 
-};
-
 /*
  * Basic ctor
  */
@@ -66,22 +54,8 @@ Rook& Rook::operator=(Rook &&other) noexcept {
 }
 
 /*
- * Returns all pseudo legal standard moves for a Bishop Piece
+ * Appends all pseudo legal standard moves for a Rook Piece to the MoveList argument
  */
-std::vector<std::unique_ptr<BoardMove>> Rook::getStandardMoves(std::unique_ptr<ChessBoard> const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves) const {
-    std::vector<std::unique_ptr<BoardMove>> moves;
-    if (chessBoard->isSquareOnBoard(fromSquare)) {
-        for (MoveDirection const &rookMoveDirection : rookMoveDirections) {
-            BoardSquare toSquare(fromSquare.boardRow + rookMoveDirection.rowDirection, fromSquare.boardCol + rookMoveDirection.colDirection);
-            while (chessBoard->isSquareEmpty(toSquare) || chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                moves.emplace_back(BoardMoveFactory::createStandardMove(fromSquare, toSquare, toSquare, false, pieceData, chessBoard->getPieceDataAt(toSquare)));
-                if (chessBoard->isSquareOtherTeam(toSquare, pieceData.team)) {
-                    break;
-                }
-                toSquare.boardRow += rookMoveDirection.rowDirection;
-                toSquare.boardCol += rookMoveDirection.colDirection;
-            }
-        }
-    }
-    return moves;
+void Rook::addStandardMoves(ChessBoard const &chessBoard, BoardSquare const &fromSquare, bool onlyAttackingMoves, MoveList &moves) const {
+    PieceMoveGenerator<ChessBoard>::addRookMoves(chessBoard, pieceData, fromSquare, moves);
 }
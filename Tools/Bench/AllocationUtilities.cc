@@ -0,0 +1,58 @@
+// AllocationUtilities.cc
+
+#include "AllocationUtilities.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+
+/*
+ * Returns the counter incremented by every replaced operator new
+ */
+std::atomic<std::uint64_t>& AllocationUtilities::getAllocationCounter() {
+    static std::atomic<std::uint64_t> allocationCounter(0);
+    return allocationCounter;
+}
+
+/*
+ * Returns the number of heap allocations made so far
+ */
+std::uint64_t AllocationUtilities::getNumAllocations() {
+    return getAllocationCounter().load(std::memory_order_relaxed);
+}
+
+
+#pragma mark - Replaced Global Allocation Functions
+
+/*
+ * Counts the allocation and forwards it to malloc
+ */
+void* operator new(std::size_t size) {
+    AllocationUtilities::getAllocationCounter().fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
@@ -0,0 +1,20 @@
+// AllocationUtilities.h
+
+#ifndef AllocationUtilities_h
+#define AllocationUtilities_h
+
+#include <atomic>
+#include <cstdint>
+
+
+/**
+ * Counts the heap allocations made through the global operator new, which AllocationUtilities.cc replaces
+ * Only linked into the bench executable
+ */
+namespace AllocationUtilities {
+    std::atomic<std::uint64_t>& getAllocationCounter();
+    std::uint64_t getNumAllocations();
+}
+
+
+#endif /* AllocationUtilities_h */
@@ -0,0 +1,14 @@
+// BenchmarkResult.cc
+
+#include "BenchmarkResult.h"
+
+#include <string>
+#include <utility>
+
+
+/*
+ * Basic ctor
+ */
+BenchmarkResult::BenchmarkResult(std::string name, std::string configuration, int numOpsPerRepetition, int numRepetitions, double medianNsPerOp, double minNsPerOp, double allocationsPerOp) :
+    name(std::move(name)), configuration(std::move(configuration)), numOpsPerRepetition(numOpsPerRepetition), numRepetitions(numRepetitions),
+    medianNsPerOp(medianNsPerOp), minNsPerOp(minNsPerOp), allocationsPerOp(allocationsPerOp) { }
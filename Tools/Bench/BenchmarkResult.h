@@ -0,0 +1,32 @@
+// BenchmarkResult.h
+
+#ifndef BenchmarkResult_h
+#define BenchmarkResult_h
+
+#include <string>
+
+
+/**
+ * BenchmarkResult Struct
+ * The cost of one operation of a benchmark in one configuration (ChessBoard size and PieceLevel)
+ * - Times are the median and the fastest of the repetitions, allocations are averaged over every timed operation
+ */
+struct BenchmarkResult final {
+    std::string name;
+    std::string configuration;
+    int numOpsPerRepetition;
+    int numRepetitions;
+    double medianNsPerOp;
+    double minNsPerOp;
+    double allocationsPerOp;
+
+    explicit BenchmarkResult(std::string name, std::string configuration, int numOpsPerRepetition, int numRepetitions, double medianNsPerOp, double minNsPerOp, double allocationsPerOp);
+    BenchmarkResult(BenchmarkResult const &other) = default;
+    BenchmarkResult(BenchmarkResult &&other) noexcept = default;
+    BenchmarkResult& operator=(BenchmarkResult const &other) = default;
+    BenchmarkResult& operator=(BenchmarkResult &&other) noexcept = default;
+    ~BenchmarkResult() = default;
+};
+
+
+#endif /* BenchmarkResult_h */
@@ -0,0 +1,95 @@
+// BenchmarkUtilities.cc
+
+#include "BenchmarkUtilities.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AllocationUtilities.h"
+#include "BenchmarkResult.h"
+
+
+/*
+ * Times the operation argument
+ * - Warm-up: the operation is run in batches of doubling size until a batch takes at least the minimum repetition time,
+ *   the size of that batch is the number of operations of each repetition
+ * - Each repetition is timed separately, the heap allocations are counted over all of them
+ */
+BenchmarkResult BenchmarkUtilities::runBenchmark(std::string const &name, std::string const &configuration, std::function<void()> const &operation,
+                                                 int numRepetitions, std::chrono::nanoseconds minRepetitionTime) {
+    auto runBatch = [&operation](int numOps) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int opIndex = 0; opIndex < numOps; ++opIndex) {
+            operation();
+        }
+        return std::chrono::steady_clock::now() - start;
+    };
+
+    // Warm-up
+    int numOpsPerRepetition = 1;
+    while (runBatch(numOpsPerRepetition) < minRepetitionTime && numOpsPerRepetition < (1 << 30)) {
+        numOpsPerRepetition *= 2;
+    }
+
+    // Repetitions
+    std::vector<double> nsPerOps;
+    std::uint64_t numAllocationsBefore = AllocationUtilities::getNumAllocations();
+    for (int repetitionIndex = 0; repetitionIndex < numRepetitions; ++repetitionIndex) {
+        double ns = std::chrono::duration<double, std::nano>(runBatch(numOpsPerRepetition)).count();
+        nsPerOps.push_back(ns / numOpsPerRepetition);
+    }
+    std::uint64_t numAllocations = AllocationUtilities::getNumAllocations() - numAllocationsBefore;
+
+    std::sort(nsPerOps.begin(), nsPerOps.end());
+    return BenchmarkResult(name, configuration, numOpsPerRepetition, numRepetitions, nsPerOps[nsPerOps.size() / 2], nsPerOps.front(),
+                           static_cast<double>(numAllocations) / (static_cast<double>(numOpsPerRepetition) * numRepetitions));
+}
+
+/*
+ * Writes the results argument as a table, one row per benchmark and configuration
+ */
+void BenchmarkUtilities::printTable(std::vector<BenchmarkResult> const &results, std::ostream &out) {
+    out << std::left << std::setw(44) << "benchmark" << std::setw(20) << "configuration" << std::right
+        << std::setw(14) << "ns/op" << std::setw(14) << "min ns/op" << std::setw(14) << "allocs/op" << std::endl;
+    for (BenchmarkResult const &result : results) {
+        out << std::left << std::setw(44) << result.name << std::setw(20) << result.configuration << std::right << std::fixed
+            << std::setprecision(1) << std::setw(14) << result.medianNsPerOp << std::setw(14) << result.minNsPerOp
+            << std::setprecision(2) << std::setw(14) << result.allocationsPerOp << std::endl;
+    }
+}
+
+/*
+ * Writes the results argument as a JSON document
+ */
+void BenchmarkUtilities::printJson(std::vector<BenchmarkResult> const &results, std::ostream &out) {
+    auto quote = [](std::string const &str) {
+        std::string quotedStr = "\"";
+        for (char ch : str) {
+            if (ch == '"' || ch == '\\') {
+                quotedStr += '\\';
+            }
+            quotedStr += ch;
+        }
+        return quotedStr + "\"";
+    };
+
+    out << "{\n  \"benchmarks\": [";
+    for (int resultIndex = 0; resultIndex < static_cast<int>(results.size()); ++resultIndex) {
+        BenchmarkResult const &result = results[resultIndex];
+        out << (resultIndex == 0 ? "\n" : ",\n") << std::fixed
+            << "    { \"name\": " << quote(result.name)
+            << ", \"configuration\": " << quote(result.configuration)
+            << ", \"ns_per_op\": " << std::setprecision(2) << result.medianNsPerOp
+            << ", \"min_ns_per_op\": " << result.minNsPerOp
+            << ", \"allocations_per_op\": " << std::setprecision(4) << result.allocationsPerOp
+            << ", \"ops_per_repetition\": " << result.numOpsPerRepetition
+            << ", \"repetitions\": " << result.numRepetitions << " }";
+    }
+    out << "\n  ]\n}" << std::endl;
+}
@@ -0,0 +1,27 @@
+// BenchmarkUtilities.h
+
+#ifndef BenchmarkUtilities_h
+#define BenchmarkUtilities_h
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BenchmarkResult.h"
+
+
+/**
+ * Utility methods for timing a repeatable operation and reporting the results
+ */
+namespace BenchmarkUtilities {
+    BenchmarkResult runBenchmark(std::string const &name, std::string const &configuration, std::function<void()> const &operation,
+                                 int numRepetitions, std::chrono::nanoseconds minRepetitionTime);
+
+    void printTable(std::vector<BenchmarkResult> const &results, std::ostream &out);
+    void printJson(std::vector<BenchmarkResult> const &results, std::ostream &out);
+}
+
+
+#endif /* BenchmarkUtilities_h */
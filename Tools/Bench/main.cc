@@ -0,0 +1,204 @@
+// main.cc
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "BenchmarkResult.h"
+#include "BenchmarkUtilities.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ChessBoardFactory.h"
+#include "ChessBoardUtilities.h"
+#include "Constants.h"
+#include "LevelFiveComputer.h"
+#include "MoveList.h"
+#include "Piece.h"
+#include "PieceData.h"
+#include "PieceFactory.h"
+
+
+/*
+ * bench [--backend mailbox|bitboard|auto] [--repetitions num] [--min-time-ms num] [--filter str] [--json [file]]
+ * Times the ChessBoard primitives, PieceFactory and the LevelFiveComputer evaluation in ns/op and heap allocations/op
+ * - Each ChessBoard benchmark runs on 8x8, 14x14 and 26x26 ChessBoards with Basic and Advanced Pieces, in a position
+ *   reached by making 12 fixed moves from the standard setup
+ * - --filter only runs the benchmarks whose name contains the argument
+ * - --json writes the results as JSON, to the file argument if there is one and in place of the table otherwise
+ * - Exits with 1 if ChessBoard::clonePosition makes more than maxClonePositionAllocationsPerOp allocations per op (rounded, a one-off
+ *   allocation during a repetition shows up as a fraction), as copying the LegalMoveCache along with the position used to cost an
+ *   allocation per cached entry
+ */
+int main(int argc, char *argv[]) {
+    long const maxClonePositionAllocationsPerOp = 8;
+    ChessBoardBackend chessBoardBackend = ChessBoardBackend::AUTO;
+    int numRepetitions = 5;
+    int minRepetitionTimeMs = 20;
+    std::string filter;
+    bool shouldPrintJson = false;
+    std::optional<std::string> jsonFileName;
+
+    // Arguments
+    for (int argIndex = 1; argIndex < argc; ++argIndex) {
+        std::string arg = argv[argIndex];
+        if (arg == "--backend" && argIndex + 1 < argc) {
+            std::string backendStr = argv[++argIndex];
+            if (backendStr == "mailbox") {
+                chessBoardBackend = ChessBoardBackend::MAILBOX;
+            } else if (backendStr == "bitboard") {
+                chessBoardBackend = ChessBoardBackend::BITBOARD;
+            } else if (backendStr == "auto") {
+                chessBoardBackend = ChessBoardBackend::AUTO;
+            } else {
+                std::cerr << "Unknown backend " << backendStr << std::endl;
+                return 2;
+            }
+        } else if (arg == "--repetitions" && argIndex + 1 < argc) {
+            numRepetitions = std::max(1, std::atoi(argv[++argIndex]));
+        } else if (arg == "--min-time-ms" && argIndex + 1 < argc) {
+            minRepetitionTimeMs = std::max(1, std::atoi(argv[++argIndex]));
+        } else if (arg == "--filter" && argIndex + 1 < argc) {
+            filter = argv[++argIndex];
+        } else if (arg == "--json") {
+            shouldPrintJson = true;
+            if (argIndex + 1 < argc && argv[argIndex + 1][0] != '-') {
+                jsonFileName = argv[++argIndex];
+            }
+        } else {
+            std::cerr << "Unknown argument " << arg << std::endl;
+            return 2;
+        }
+    }
+
+    std::vector<BenchmarkResult> results;
+    volatile std::uint64_t sink = 0;        // Keeps the results of the operations alive
+    auto runBenchmark = [&](std::string const &name, std::string const &configuration, std::function<void()> const &operation) {
+        if (name.find(filter) != std::string::npos) {
+            results.emplace_back(BenchmarkUtilities::runBenchmark(name, configuration, operation, numRepetitions, std::chrono::milliseconds(minRepetitionTimeMs)));
+            if (!jsonFileName.has_value() && !shouldPrintJson) {
+                std::cerr << "." << std::flush;
+            }
+        }
+    };
+
+    for (PieceLevel pieceLevel : { PieceLevel::BASIC, PieceLevel::ADVANCED }) {
+        std::string pieceLevelStr = pieceLevel == PieceLevel::BASIC ? "basic" : "advanced";
+
+        // PieceFactory, independent of the ChessBoard
+        std::vector<PieceData> pieceDatas;
+        for (PieceType pieceType : { PieceType::PAWN, PieceType::KNIGHT, PieceType::BISHOP, PieceType::ROOK, PieceType::QUEEN, PieceType::KING }) {
+            for (PieceDirection pieceDirection : { PieceDirection::NORTH, PieceDirection::SOUTH, PieceDirection::EAST, PieceDirection::WEST }) {
+                pieceDatas.emplace_back(pieceType, pieceLevel, Team::TEAM_ONE, pieceDirection, false);
+                pieceDatas.emplace_back(pieceType, pieceLevel, Team::TEAM_TWO, pieceDirection, true);
+            }
+        }
+        int pieceDataIndex = 0;
+        runBenchmark("PieceFactory::getPiece", pieceLevelStr, [&]() {
+            sink = sink + PieceFactory::getPiece(pieceDatas[pieceDataIndex]).getPieceInfo().pieceScore;
+            pieceDataIndex = (pieceDataIndex + 1) % pieceDatas.size();
+        });
+
+        for (int boardSize : { 8, 14, 26 }) {
+            std::string configuration = std::to_string(boardSize) + "x" + std::to_string(boardSize) + " " + pieceLevelStr;
+
+            // Position, the standard setup after 12 fixed moves
+            std::unique_ptr<ChessBoard> chessBoard = ChessBoardFactory::createChessBoard(boardSize, boardSize, chessBoardBackend);
+            ChessBoardUtilities::applyStandardSetup(chessBoard, pieceLevel);
+            for (int ply = 0; ply < 12; ++ply) {
+                MoveList moves;
+                chessBoard->generateAllLegalMoves(chessBoard->getTeamToMove(), moves);
+                if (moves.empty()) {
+                    break;
+                }
+                chessBoard->makeMove(moves[(ply * 7 + 3) % moves.size()]);
+            }
+            Team team = chessBoard->getTeamToMove();
+
+            MoveList legalMoves;
+            chessBoard->generateAllLegalMoves(team, legalMoves);
+            std::vector<BoardSquare> boardSquares;
+            for (BoardSquare const &boardSquare : *chessBoard) {
+                boardSquares.push_back(boardSquare);
+            }
+            LevelFiveComputer levelFiveComputer(team);
+            int legalMoveIndex = 0;
+            int boardSquareIndex = 0;
+
+            runBenchmark("ChessBoard::clone", configuration, [&]() {
+                sink = sink + chessBoard->clone()->getNumRowsOnBoard();
+            });
+            runBenchmark("ChessBoard::clonePosition", configuration, [&]() {
+                sink = sink + chessBoard->clonePosition()->getNumRowsOnBoard();
+            });
+            runBenchmark("ChessBoard::makeMove+undoMove", configuration, [&]() {
+                chessBoard->makeMove(legalMoves[legalMoveIndex]);
+                chessBoard->undoMove();
+                legalMoveIndex = (legalMoveIndex + 1) % legalMoves.size();
+            });
+            runBenchmark("ChessBoard::isSquareAttacked", configuration, [&]() {
+                sink = sink + chessBoard->isSquareAttacked(boardSquares[boardSquareIndex], team);
+                boardSquareIndex = (boardSquareIndex + 1) % boardSquares.size();
+            });
+            runBenchmark("ChessBoard::isInCheck", configuration, [&]() {
+                sink = sink + chessBoard->isInCheck(team);
+            });
+            runBenchmark("ChessBoard::generateAllLegalMoves", configuration, [&]() {
+                MoveList moves;
+                chessBoard->generateAllLegalMoves(team, moves);
+                sink = sink + moves.size();
+            });
+            runBenchmark("ChessBoard::generateCheckApplyingMoves", configuration, [&]() {
+                sink = sink + chessBoard->generateCheckApplyingMoves(team).size();
+            });
+            runBenchmark("ChessBoard::generateCapturingMoves", configuration, [&]() {
+                sink = sink + chessBoard->generateCapturingMoves(team).size();
+            });
+            runBenchmark("ChessBoard::generateCaptureAvoidingMoves", configuration, [&]() {
+                sink = sink + chessBoard->generateCaptureAvoidingMoves(team).size();
+            });
+            runBenchmark("ChessBoard::generateWinningMoves", configuration, [&]() {
+                sink = sink + chessBoard->generateWinningMoves(team).size();
+            });
+            runBenchmark("ChessBoard::generateClassifiedMoves", configuration, [&]() {
+                sink = sink + chessBoard->generateClassifiedMoves(team).size();
+            });
+            runBenchmark("LevelFiveComputer::getAlphaBetaBoardScore", configuration, [&]() {
+                sink = sink + levelFiveComputer.getAlphaBetaBoardScore(chessBoard, team);
+            });
+        }
+    }
+
+    // Report
+    if (!jsonFileName.has_value() && !shouldPrintJson) {
+        std::cerr << std::endl;
+    }
+    if (jsonFileName.has_value()) {
+        std::ofstream jsonFile(jsonFileName.value());
+        BenchmarkUtilities::printJson(results, jsonFile);
+        BenchmarkUtilities::printTable(results, std::cout);
+    } else if (shouldPrintJson) {
+        BenchmarkUtilities::printJson(results, std::cout);
+    } else {
+        BenchmarkUtilities::printTable(results, std::cout);
+    }
+
+    // Allocation budget
+    bool isWithinBudget = true;
+    for (BenchmarkResult const &result : results) {
+        if (result.name == "ChessBoard::clonePosition" && std::lround(result.allocationsPerOp) > maxClonePositionAllocationsPerOp) {
+            std::cerr << result.name << " on " << result.configuration << " makes " << result.allocationsPerOp
+                      << " allocations/op, more than the budget of " << maxClonePositionAllocationsPerOp << std::endl;
+            isWithinBudget = false;
+        }
+    }
+    return isWithinBudget ? 0 : 1;
+}
@@ -0,0 +1,59 @@
+// PerftHashTable.cc
+
+#include "PerftHashTable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+
+#pragma mark - Slot
+
+/*
+ * Basic ctor
+ * An empty slot holds depth 0, which is never stored, so it can't match a lookup
+ */
+PerftHashTable::Slot::Slot() :
+    key(0), data(0) { }
+
+
+#pragma mark - PerftHashTable
+
+/*
+ * Basic ctor
+ */
+PerftHashTable::PerftHashTable(int numSlots) :
+    slots(numSlots) { }
+
+/*
+ * Return Optional leaf count
+ * - value if the subtree of the depth argument below the position with the hash argument has been counted
+ * - nullopt otherwise
+ */
+std::optional<std::uint64_t> PerftHashTable::find(std::uint64_t positionHash, int depth) const {
+    Slot const &slot = slots[(positionHash ^ static_cast<std::uint64_t>(depth)) % slots.size()];
+    std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+    std::uint64_t key = slot.key.load(std::memory_order_relaxed);
+    if ((key ^ data) == positionHash && static_cast<int>(data & ((1 << depthBits) - 1)) == depth) {
+        return data >> depthBits;
+    }
+    return std::nullopt;
+}
+
+/*
+ * Stores the leaf count of the subtree of the depth argument below the position with the hash argument
+ */
+void PerftHashTable::insert(std::uint64_t positionHash, int depth, std::uint64_t numLeafNodes) {
+    Slot &slot = slots[(positionHash ^ static_cast<std::uint64_t>(depth)) % slots.size()];
+    std::uint64_t data = (numLeafNodes << depthBits) | static_cast<std::uint64_t>(depth);
+    slot.key.store(positionHash ^ data, std::memory_order_relaxed);
+    slot.data.store(data, std::memory_order_relaxed);
+}
+
+/*
+ * Returns the number of slots
+ */
+int PerftHashTable::getNumSlots() const {
+    return slots.size();
+}
@@ -0,0 +1,55 @@
+// PerftHashTable.h
+
+#ifndef PerftHashTable_h
+#define PerftHashTable_h
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+
+/**
+ * PerftHashTable Class
+ * Leaf counts of already counted subtrees, keyed by (position hash, depth), shared by every perft worker thread without locking
+ * - Each slot is two atomic words, the data word (leaf count and depth) and the key word (position hash xor data word)
+ * - A slot torn by two threads storing at once fails the xor check on lookup and reads as a miss, it never returns a wrong count
+ * - Direct mapped, a newer subtree replaces whatever occupied its slot
+ */
+class PerftHashTable final {
+private:
+    /**
+     * Slot Struct
+     */
+    struct Slot final {
+        std::atomic<std::uint64_t> key;
+        std::atomic<std::uint64_t> data;
+
+        Slot();
+        Slot(Slot const &other) = delete;
+        Slot(Slot &&other) noexcept = delete;
+        Slot& operator=(Slot const &other) = delete;
+        Slot& operator=(Slot &&other) noexcept = delete;
+        ~Slot() = default;
+    };
+
+    static int const depthBits = 8;
+
+    std::vector<Slot> slots;
+
+public:
+    explicit PerftHashTable(int numSlots);
+    PerftHashTable(PerftHashTable const &other) = delete;
+    PerftHashTable(PerftHashTable &&other) noexcept = delete;
+    PerftHashTable& operator=(PerftHashTable const &other) = delete;
+    PerftHashTable& operator=(PerftHashTable &&other) noexcept = delete;
+    ~PerftHashTable() = default;
+
+    std::optional<std::uint64_t> find(std::uint64_t positionHash, int depth) const;
+    void insert(std::uint64_t positionHash, int depth, std::uint64_t numLeafNodes);
+
+    int getNumSlots() const;
+};
+
+
+#endif /* PerftHashTable_h */
@@ -0,0 +1,52 @@
+// PerftPosition.cc
+
+#include "PerftPosition.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "ChessBoard.h"
+
+
+/*
+ * Basic ctor
+ */
+PerftPosition::PerftPosition(std::string name, std::unique_ptr<ChessBoard> chessBoard) :
+    name(std::move(name)), chessBoard(std::move(chessBoard)) { }
+
+/*
+ * Copy ctor
+ */
+PerftPosition::PerftPosition(PerftPosition const &other) :
+    name(other.name), chessBoard(other.chessBoard->clone()), expectedLeafCounts(other.expectedLeafCounts) { }
+
+/*
+ * Move ctor
+ */
+PerftPosition::PerftPosition(PerftPosition &&other) noexcept :
+    name(std::move(other.name)), chessBoard(std::move(other.chessBoard)), expectedLeafCounts(std::move(other.expectedLeafCounts)) { }
+
+/*
+ * Copy assignment
+ */
+PerftPosition& PerftPosition::operator=(PerftPosition const &other) {
+    if (this != &other) {
+        name = other.name;
+        chessBoard = other.chessBoard->clone();
+        expectedLeafCounts = other.expectedLeafCounts;
+    }
+    return *this;
+}
+
+/*
+ * Move assignment
+ */
+PerftPosition& PerftPosition::operator=(PerftPosition &&other) noexcept {
+    if (this != &other) {
+        name = std::move(other.name);
+        chessBoard = std::move(other.chessBoard);
+        expectedLeafCounts = std::move(other.expectedLeafCounts);
+    }
+    return *this;
+}
@@ -0,0 +1,33 @@
+// PerftPosition.h
+
+#ifndef PerftPosition_h
+#define PerftPosition_h
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ChessBoard.h"
+
+
+/**
+ * PerftPosition Struct
+ * A named ChessBoard position to count the leaf nodes of, the Team to move is the ChessBoard's
+ * - expectedLeafCounts holds the known leaf counts by depth, a count that does not match is reported as a regression
+ */
+struct PerftPosition final {
+    std::string name;
+    std::unique_ptr<ChessBoard> chessBoard;
+    std::map<int, std::uint64_t> expectedLeafCounts;
+
+    explicit PerftPosition(std::string name, std::unique_ptr<ChessBoard> chessBoard);
+    PerftPosition(PerftPosition const &other);
+    PerftPosition(PerftPosition &&other) noexcept;
+    PerftPosition& operator=(PerftPosition const &other);
+    PerftPosition& operator=(PerftPosition &&other) noexcept;
+    ~PerftPosition() = default;
+};
+
+
+#endif /* PerftPosition_h */
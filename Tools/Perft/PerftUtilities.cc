@@ -0,0 +1,416 @@
+// PerftUtilities.cc
+
+#include "PerftUtilities.h"
+
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ChessBoardFactory.h"
+#include "ChessBoardUtilities.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "MoveList.h"
+#include "PerftHashTable.h"
+#include "PerftPosition.h"
+#include "PieceData.h"
+#include "Utilities.h"
+
+
+/*
+ * Returns the number of leaf nodes of the legal move tree of the depth argument, starting with the ChessBoard's Team to move
+ * Moves are made and undone on the ChessBoard argument, which is left in the position it started in
+ * The last ply is counted from the size of the legal move list rather than by making each move
+ * Subtrees of depth 2 or more are looked up in and stored to the PerftHashTable argument, if there is one
+ */
+std::uint64_t PerftUtilities::countLeafNodes(ChessBoard &chessBoard, int depth, PerftHashTable *perftHashTable) {
+    if (depth == 0) {
+        return 1;
+    }
+
+    bool shouldUseHashTable = perftHashTable != nullptr && depth >= 2;
+    if (shouldUseHashTable) {
+        std::optional<std::uint64_t> numHashedLeafNodes = perftHashTable->find(chessBoard.getPositionHash(), depth);
+        if (numHashedLeafNodes.has_value()) {
+            return numHashedLeafNodes.value();
+        }
+    }
+
+    MoveList moves;
+    chessBoard.generateAllLegalMoves(chessBoard.getTeamToMove(), moves);
+    if (depth == 1) {
+        return moves.size();
+    }
+
+    std::uint64_t numLeafNodes = 0;
+    for (MoveCode moveCode : moves) {
+        chessBoard.makeMove(moveCode);
+        numLeafNodes += countLeafNodes(chessBoard, depth - 1, perftHashTable);
+        chessBoard.undoMove();
+    }
+
+    if (shouldUseHashTable) {
+        perftHashTable->insert(chessBoard.getPositionHash(), depth, numLeafNodes);
+    }
+    return numLeafNodes;
+}
+
+/*
+ * Returns the number of leaf nodes of the depth argument below each legal root move, in move generation order
+ * The tree is split into subtrees, expanding it a ply at a time until there are enough of them to keep the threads busy,
+ * which are then counted by a pool of the number of threads argument, each thread on its own copy of the ChessBoard
+ */
+std::vector<std::pair<MoveCode, std::uint64_t>> PerftUtilities::divide(ChessBoard const &chessBoard, int depth, int numThreads, PerftHashTable *perftHashTable) {
+    static int const minSubtreesPerThread = 16;
+
+    std::vector<std::pair<MoveCode, std::uint64_t>> rootMoveLeafCounts;
+    if (depth == 0) {
+        return rootMoveLeafCounts;
+    }
+
+    // Split the tree into the move sequences leading to each subtree
+    std::unique_ptr<ChessBoard> splitChessBoard = chessBoard.clone();
+    std::vector<std::vector<MoveCode>> subtreeMovePaths = { {} };
+    int subtreeDepth = depth;
+    do {
+        std::vector<std::vector<MoveCode>> nextSubtreeMovePaths;
+        for (std::vector<MoveCode> const &subtreeMovePath : subtreeMovePaths) {
+            for (MoveCode moveCode : subtreeMovePath) {
+                splitChessBoard->makeMove(moveCode);
+            }
+            MoveList moves;
+            splitChessBoard->generateAllLegalMoves(splitChessBoard->getTeamToMove(), moves);
+            for (MoveCode moveCode : moves) {
+                nextSubtreeMovePaths.emplace_back(subtreeMovePath).push_back(moveCode);
+            }
+            if (moves.empty() && !subtreeMovePath.empty()) {
+                nextSubtreeMovePaths.emplace_back(subtreeMovePath);      // Game over before the subtree depth, kept so its root move is still listed
+            }
+            for (int numMovesToUndo = subtreeMovePath.size(); numMovesToUndo > 0; --numMovesToUndo) {
+                splitChessBoard->undoMove();
+            }
+        }
+        subtreeMovePaths = std::move(nextSubtreeMovePaths);
+        --subtreeDepth;
+    } while (subtreeDepth > 2 && static_cast<int>(subtreeMovePaths.size()) < numThreads * minSubtreesPerThread);
+
+    // Count the subtrees, each thread taking the next one not yet taken until there are none left
+    std::vector<std::uint64_t> subtreeLeafCounts(subtreeMovePaths.size());
+    std::atomic<int> nextSubtreeIndex(0);
+    auto countSubtrees = [&]() {
+        std::unique_ptr<ChessBoard> workerChessBoard = chessBoard.clone();
+        for (int subtreeIndex = nextSubtreeIndex++; subtreeIndex < static_cast<int>(subtreeMovePaths.size()); subtreeIndex = nextSubtreeIndex++) {
+            std::vector<MoveCode> const &subtreeMovePath = subtreeMovePaths[subtreeIndex];
+            for (MoveCode moveCode : subtreeMovePath) {
+                workerChessBoard->makeMove(moveCode);
+            }
+            subtreeLeafCounts[subtreeIndex] = countLeafNodes(*workerChessBoard, subtreeDepth, perftHashTable);
+            for (int numMovesToUndo = subtreeMovePath.size(); numMovesToUndo > 0; --numMovesToUndo) {
+                workerChessBoard->undoMove();
+            }
+        }
+    };
+
+    std::vector<std::thread> workerThreads;
+    for (int threadIndex = 1; threadIndex < numThreads; ++threadIndex) {
+        workerThreads.emplace_back(countSubtrees);
+    }
+    countSubtrees();
+    for (std::thread &workerThread : workerThreads) {
+        workerThread.join();
+    }
+
+    // Sum the subtrees below each root move, the move paths are in root move order
+    for (int subtreeIndex = 0; subtreeIndex < static_cast<int>(subtreeMovePaths.size()); ++subtreeIndex) {
+        MoveCode rootMoveCode = subtreeMovePaths[subtreeIndex].front();
+        if (rootMoveLeafCounts.empty() || rootMoveLeafCounts.back().first != rootMoveCode) {
+            rootMoveLeafCounts.emplace_back(rootMoveCode, 0);
+        }
+        rootMoveLeafCounts.back().second += subtreeLeafCounts[subtreeIndex];
+    }
+    return rootMoveLeafCounts;
+}
+
+/*
+ * Returns the positions counted when no positions file is given
+ * Covers the standard setup, Advanced Pieces, a larger ChessBoard, Pieces moving east / west, Pawns facing every direction
+ * at once, two 8x8 ChessBoards of north / south Pawns that the AUTO backend keeps on its StandardChessBoardImpl, and a narrow
+ * ChessBoard with an east facing Pawn on the last column
+ * - mixed-pawns, occupied-en-passant and en-passant-out-of-check capture en passant onto an occupied square, the last one
+ *   capturing the checking Piece that stood on the to square
+ * - narrow-en-passant has an en passant square beside a Pawn whose en passant to square would lie off the ChessBoard
+ * - The leaf counts of the standard setup and kiwipete are the well known ones of standard chess, those of the other en passant
+ *   positions are those of the original clone per move ChessBoard, which crashed on narrow-en-passant
+ */
+std::vector<PerftPosition> PerftUtilities::createBuiltInPositions(ChessBoardBackend chessBoardBackend) {
+    static std::string const builtInPositions = R"(
+        position standard
+        standard basic
+        expect 1 20
+        expect 2 400
+        expect 3 8902
+        expect 4 197281
+
+        position standard-advanced
+        standard advanced
+        expect 1 36
+        expect 2 1259
+        expect 3 48244
+        expect 4 1786680
+
+        position large-advanced
+        set 10 14
+        standard advanced
+        expect 1 48
+        expect 2 2303
+        expect 3 125885
+        expect 4 6851358
+
+        position sideways
+        + a8 R basic east
+        + a7 N basic east
+        + a6 B basic east
+        + a5 Q basic east
+        + a4 K basic east
+        + a3 B basic east
+        + a2 N basic east
+        + a1 R basic east
+        + b8 P basic east
+        + b7 P basic east
+        + b6 P basic east
+        + b5 P basic east
+        + b4 P basic east
+        + b3 P basic east
+        + b2 P basic east
+        + b1 P basic east
+        + h8 r basic west
+        + h7 n basic west
+        + h6 b basic west
+        + h5 q basic west
+        + h4 k basic west
+        + h3 b basic west
+        + h2 n basic west
+        + h1 r basic west
+        + g8 p basic west
+        + g7 p basic west
+        + g6 p basic west
+        + g5 p basic west
+        + g4 p basic west
+        + g3 p basic west
+        + g2 p basic west
+        + g1 p basic west
+        expect 1 20
+        expect 2 400
+        expect 3 8902
+        expect 4 197281
+
+        position mixed-pawns
+        set 10 8
+        + f9 K basic north
+        + e3 k basic south
+        + c3 P basic west
+        + e6 p advanced east
+        + f8 P advanced north
+        + f7 p basic east
+        + e9 P basic south
+        + g3 p basic west
+        + d7 p basic south
+        + d2 p advanced west
+        expect 1 12
+        expect 2 289
+        expect 3 3914
+        expect 4 104292
+
+        position occupied-en-passant
+        + e1 K
+        + d5 P basic north moved
+        + e8 k
+        + e3 p basic north
+        + e6 n
+        swap
+        expect 1 15
+        expect 2 96
+        expect 3 1227
+        expect 4 9005
+
+        position en-passant-out-of-check
+        + a1 K basic north
+        + b5 P basic south
+        + f7 P basic south
+        + f4 k
+        + a4 q
+        + c4 n
+        + a7 p
+        + g4 p
+        + h6 p basic north
+        + h7 p basic south moved
+        swap
+        expect 1 29
+        expect 2 76
+        expect 3 2041
+        expect 4 9672
+
+        position narrow-en-passant
+        set 9 5
+        + a1 K
+        + a9 k
+        + c4 P basic east
+        + e5 p basic east moved
+        + e3 p basic west
+        expect 1 8
+        expect 2 43
+        expect 3 427
+        expect 4 2450
+
+        position kiwipete
+        + a1 R
+        + e1 K
+        + h1 R
+        + a2 P
+        + b2 P
+        + c2 P
+        + d2 B
+        + e2 B
+        + f2 P
+        + g2 P
+        + h2 P
+        + c3 N
+        + f3 Q
+        + e4 P basic north moved
+        + d5 P basic north moved
+        + e5 N
+        + a8 r
+        + e8 k
+        + h8 r
+        + a7 p
+        + c7 p
+        + d7 p
+        + e7 q
+        + f7 p
+        + g7 b
+        + a6 b
+        + b6 n
+        + e6 p basic south moved
+        + f6 n
+        + g6 p basic south moved
+        + b4 p basic south moved
+        + h3 p basic south moved
+        expect 1 48
+        expect 2 2039
+        expect 3 97862
+        expect 4 4085603
+    )";
+
+    std::istringstream in(builtInPositions);
+    std::ostringstream err;
+    return readPositions(in, chessBoardBackend, err).value();
+}
+
+/*
+ * Return Optional vector of PerftPositions
+ * - value if every line of the istream argument is a valid positions file line (see PerftUtilities.h)
+ * - nullopt otherwise, with the offending line reported to the ostream argument
+ */
+std::optional<std::vector<PerftPosition>> PerftUtilities::readPositions(std::istream &in, ChessBoardBackend chessBoardBackend, std::ostream &err) {
+    static std::regex const ignoredPattern(R"(\s*(#.*)?)");
+    static std::regex const positionPattern(R"(\s*position\s+(\S+)\s*)", std::regex_constants::icase);
+    static std::regex const setBoardSizePattern(R"(\s*set\s*([1-9][0-9]*)\s*([1-9][0-9]*)\s*)", std::regex_constants::icase);
+    static std::regex const standardSetupPattern(R"(\s*standard\s*(basic|advanced)?\s*)", std::regex_constants::icase);
+    static std::regex const placePiecePattern(R"(\s*\+\s*([a-z]+[1-9][0-9]*)\s*([a-zA-Z])\s*(basic|advanced)?\s*(north|south|west|east)?\s*(moved)?\s*)", std::regex_constants::icase);
+    static std::regex const removePiecePattern(R"(\s*-\s*([a-z]+[1-9][0-9]*)\s*)", std::regex_constants::icase);
+    static std::regex const swapFirstTurnPattern(R"(\s*swap\s*)", std::regex_constants::icase);
+    static std::regex const expectPattern(R"(\s*expect\s+([1-9][0-9]*)\s+([0-9]+)\s*)", std::regex_constants::icase);
+
+    std::vector<PerftPosition> positions;
+    std::string line;
+    int lineNumber = 0;
+    auto reportInvalidLine = [&err, &lineNumber](std::string const &message) {
+        err << "Line " << lineNumber << ": " << message << std::endl;
+    };
+
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        std::smatch matches;
+        if (std::regex_match(line, matches, ignoredPattern)) {
+            continue;
+
+        } else if (std::regex_match(line, matches, positionPattern)) {
+            positions.emplace_back(matches[1].str(), ChessBoardFactory::createChessBoard(8, 8, chessBoardBackend));
+            continue;
+
+        } else if (positions.empty()) {
+            reportInvalidLine("Expected a position line first");
+            return std::nullopt;
+        }
+
+        std::unique_ptr<ChessBoard> &chessBoard = positions.back().chessBoard;
+        if (std::regex_match(line, matches, setBoardSizePattern)) {
+            int numRows = std::stoi(matches[1].str());
+            int numCols = std::stoi(matches[2].str());
+            if (numRows < 4 || numRows > 26 || numCols < 4 || numCols > 26) {
+                reportInvalidLine("Number of rows and cols must be between 4 and 26 inclusive");
+                return std::nullopt;
+            }
+            chessBoard = ChessBoardFactory::createChessBoard(numRows, numCols, chessBoardBackend);
+
+        } else if (std::regex_match(line, matches, standardSetupPattern)) {
+            PieceLevel pieceLevel = matches[1].matched
+                ? Utilities::stringToPieceLevel(matches[1].str()).value()
+                : PieceLevel::BASIC;
+            if (!ChessBoardUtilities::applyStandardSetup(chessBoard, pieceLevel)) {
+                reportInvalidLine("Board is too small to apply standard setup");
+                return std::nullopt;
+            }
+
+        } else if (std::regex_match(line, matches, placePiecePattern)) {
+            std::optional<BoardSquare> boardSquare = BoardSquare::createBoardSquare(matches[1].str(), chessBoard->getNumRowsOnBoard(), chessBoard->getNumColsOnBoard());
+            std::optional<PieceType> pieceType = Utilities::stringToPieceType(matches[2].str());
+            if (!boardSquare.has_value() || !chessBoard->isSquareOnBoard(boardSquare.value())) {
+                reportInvalidLine("Input square is not valid");
+                return std::nullopt;
+            } else if (!pieceType.has_value()) {
+                reportInvalidLine("Input piece is not valid");
+                return std::nullopt;
+            }
+
+            Team team = std::isupper(matches[2].str().front()) ? chessBoard->getTeamOne() : chessBoard->getTeamTwo();
+            PieceLevel pieceLevel = matches[3].matched
+                ? Utilities::stringToPieceLevel(matches[3].str()).value()
+                : PieceLevel::BASIC;
+            PieceDirection pieceDirection = matches[4].matched
+                ? Utilities::stringToPieceDirection(matches[4].str()).value()
+                : team == chessBoard->getTeamOne() ? PieceDirection::NORTH : PieceDirection::SOUTH;
+            chessBoard->setPosition(boardSquare.value(), PieceData(pieceType.value(), pieceLevel, team, pieceDirection, matches[5].matched));
+
+        } else if (std::regex_match(line, matches, removePiecePattern)) {
+            std::optional<BoardSquare> boardSquare = BoardSquare::createBoardSquare(matches[1].str(), chessBoard->getNumRowsOnBoard(), chessBoard->getNumColsOnBoard());
+            if (!boardSquare.has_value() || !chessBoard->isSquareOnBoard(boardSquare.value())) {
+                reportInvalidLine("Input square is not valid");
+                return std::nullopt;
+            }
+            chessBoard->clearPosition(boardSquare.value());
+
+        } else if (std::regex_match(line, matches, swapFirstTurnPattern)) {
+            chessBoard->setTeamToMove(chessBoard->getTeamToMove() == chessBoard->getTeamOne() ? chessBoard->getTeamTwo() : chessBoard->getTeamOne());
+
+        } else if (std::regex_match(line, matches, expectPattern)) {
+            positions.back().expectedLeafCounts[std::stoi(matches[1].str())] = std::stoull(matches[2].str());
+
+        } else {
+            reportInvalidLine("Invalid line \"" + line + "\"");
+            return std::nullopt;
+        }
+    }
+    return positions;
+}
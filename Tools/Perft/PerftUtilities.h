@@ -0,0 +1,42 @@
+// PerftUtilities.h
+
+#ifndef PerftUtilities_h
+#define PerftUtilities_h
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ChessBoard.h"
+#include "Constants.h"
+#include "MoveCode.h"
+#include "PerftHashTable.h"
+#include "PerftPosition.h"
+
+
+/**
+ * Utility methods for counting the leaf nodes of the legal move tree of a ChessBoard position (perft)
+ *
+ * Positions are read from a text file with the setup mode commands of the game, plus a few of their own:
+ *   position <name>                                     Starts a new position on an empty 8x8 ChessBoard
+ *   set <rows> <cols>                                   Replaces the ChessBoard with an empty one of the size argument
+ *   standard [basic|advanced]                           Applies the standard setup
+ *   + <square> <piece> [level] [direction] [moved]      Places a Piece, uppercase for White, moved marks it as having moved
+ *   - <square>                                          Removes a Piece
+ *   swap                                                Gives Black the first move
+ *   expect <depth> <leaves>                             Known leaf count of the position at the depth argument
+ * Blank lines and lines starting with # are ignored
+ */
+namespace PerftUtilities {
+    std::uint64_t countLeafNodes(ChessBoard &chessBoard, int depth, PerftHashTable *perftHashTable = nullptr);
+    std::vector<std::pair<MoveCode, std::uint64_t>> divide(ChessBoard const &chessBoard, int depth, int numThreads = 1, PerftHashTable *perftHashTable = nullptr);
+
+    std::vector<PerftPosition> createBuiltInPositions(ChessBoardBackend chessBoardBackend);
+    std::optional<std::vector<PerftPosition>> readPositions(std::istream &in, ChessBoardBackend chessBoardBackend, std::ostream &err);
+}
+
+
+#endif /* PerftUtilities_h */
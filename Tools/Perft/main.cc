@@ -0,0 +1,146 @@
+// main.cc
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Constants.h"
+#include "MoveCode.h"
+#include "PerftHashTable.h"
+#include "PerftPosition.h"
+#include "PerftUtilities.h"
+
+
+/*
+ * perft [depth] [--divide] [--backend mailbox|bitboard|auto] [--threads num] [--hash megabytes] [positions file]
+ * Counts the leaf nodes of every position at each depth up to the depth argument (3 by default) and reports the nodes per second
+ * - --divide also breaks the count at the deepest depth down by root move
+ * - --threads sets the number of threads counting subtrees, every core by default
+ * - --hash shares a PerftHashTable of the size argument between the threads, off by default
+ * - Without a positions file the built in positions are counted
+ * Exits with a non zero status if a count does not match an expected one
+ */
+int main(int argc, char *argv[]) {
+    int maxDepth = 3;
+    bool shouldDivide = false;
+    ChessBoardBackend chessBoardBackend = ChessBoardBackend::AUTO;
+    int numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int hashTableMegabytes = 0;
+    std::optional<std::string> positionsFileName;
+
+    // Arguments
+    for (int argIndex = 1; argIndex < argc; ++argIndex) {
+        std::string arg = argv[argIndex];
+        if (arg == "--divide") {
+            shouldDivide = true;
+        } else if (arg == "--backend" && argIndex + 1 < argc) {
+            std::string backendStr = argv[++argIndex];
+            if (backendStr == "mailbox") {
+                chessBoardBackend = ChessBoardBackend::MAILBOX;
+            } else if (backendStr == "bitboard") {
+                chessBoardBackend = ChessBoardBackend::BITBOARD;
+            } else if (backendStr == "auto") {
+                chessBoardBackend = ChessBoardBackend::AUTO;
+            } else {
+                std::cerr << "Unknown backend " << backendStr << std::endl;
+                return 2;
+            }
+        } else if (arg == "--threads" && argIndex + 1 < argc) {
+            numThreads = std::max(1, std::atoi(argv[++argIndex]));
+        } else if (arg == "--hash" && argIndex + 1 < argc) {
+            hashTableMegabytes = std::max(0, std::atoi(argv[++argIndex]));
+        } else if (!arg.empty() && std::isdigit(arg.front())) {
+            maxDepth = std::stoi(arg);
+        } else {
+            positionsFileName = arg;
+        }
+    }
+
+    // Positions
+    std::vector<PerftPosition> positions;
+    if (positionsFileName.has_value()) {
+        std::ifstream positionsFile(positionsFileName.value());
+        if (!positionsFile) {
+            std::cerr << "Can't open " << positionsFileName.value() << std::endl;
+            return 2;
+        }
+        std::optional<std::vector<PerftPosition>> readPositions = PerftUtilities::readPositions(positionsFile, chessBoardBackend, std::cerr);
+        if (!readPositions.has_value()) {
+            return 2;
+        }
+        positions = std::move(readPositions.value());
+    } else {
+        positions = PerftUtilities::createBuiltInPositions(chessBoardBackend);
+    }
+
+    // Hash table
+    std::unique_ptr<PerftHashTable> perftHashTable;
+    if (hashTableMegabytes > 0) {
+        perftHashTable = std::make_unique<PerftHashTable>(hashTableMegabytes * (1 << 20) / 16);
+    }
+    std::cout << "Using " << numThreads << " thread(s)";
+    if (perftHashTable != nullptr) {
+        std::cout << " and a " << hashTableMegabytes << " MB hash table";
+    }
+    std::cout << std::endl;
+
+    // Count
+    int numMismatches = 0;
+    std::uint64_t totalNumLeafNodes = 0;
+    double totalSeconds = 0;
+    for (PerftPosition &position : positions) {
+        ChessBoard &chessBoard = *position.chessBoard;
+        std::cout << position.name << " (" << chessBoard.getNumRowsOnBoard() << "x" << chessBoard.getNumColsOnBoard() << ", "
+                  << (chessBoard.getTeamToMove() == chessBoard.getTeamOne() ? "White" : "Black") << " to move)" << std::endl;
+
+        std::vector<std::pair<MoveCode, std::uint64_t>> rootMoveLeafCounts;
+        for (int depth = 1; depth <= maxDepth; ++depth) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            rootMoveLeafCounts = PerftUtilities::divide(chessBoard, depth, numThreads, perftHashTable.get());
+            std::uint64_t numLeafNodes = 0;
+            for (std::pair<MoveCode, std::uint64_t> const &rootMoveLeafCount : rootMoveLeafCounts) {
+                numLeafNodes += rootMoveLeafCount.second;
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            totalNumLeafNodes += numLeafNodes;
+            totalSeconds += seconds;
+
+            std::cout << "  depth " << std::setw(2) << depth << std::setw(16) << numLeafNodes
+                      << std::fixed << std::setprecision(3) << std::setw(10) << seconds << "s"
+                      << std::setw(14) << static_cast<std::uint64_t>(seconds > 0 ? numLeafNodes / seconds : 0) << " nps";
+            auto expectedLeafCount = position.expectedLeafCounts.find(depth);
+            if (expectedLeafCount != position.expectedLeafCounts.end() && expectedLeafCount->second != numLeafNodes) {
+                std::cout << "  MISMATCH, expected " << expectedLeafCount->second;
+                ++numMismatches;
+            }
+            std::cout << std::endl;
+        }
+
+        if (shouldDivide) {
+            for (std::pair<MoveCode, std::uint64_t> const &rootMoveLeafCount : rootMoveLeafCounts) {
+                std::cout << "    " << std::setw(8) << std::left << MoveCodeUtilities::toString(rootMoveLeafCount.first, chessBoard)
+                          << std::right << rootMoveLeafCount.second << std::endl;
+            }
+        }
+    }
+
+    // Summary
+    std::cout << "Total " << totalNumLeafNodes << " leaves in " << std::fixed << std::setprecision(3) << totalSeconds << "s, "
+              << static_cast<std::uint64_t>(totalSeconds > 0 ? totalNumLeafNodes / totalSeconds : 0) << " nps" << std::endl;
+    if (numMismatches > 0) {
+        std::cout << numMismatches << " leaf count(s) did not match" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,12 @@
+// ScalingResult.cc
+
+#include "ScalingResult.h"
+
+#include "Constants.h"
+
+
+/*
+ * Basic ctor
+ */
+ScalingResult::ScalingResult(int numRowsOnBoard, int numColsOnBoard, PieceLevel pieceLevel, double fillerDensity) :
+    numRowsOnBoard(numRowsOnBoard), numColsOnBoard(numColsOnBoard), pieceLevel(pieceLevel), fillerDensity(fillerDensity) { }
@@ -0,0 +1,42 @@
+// ScalingResult.h
+
+#ifndef ScalingResult_h
+#define ScalingResult_h
+
+#include <cstdint>
+
+#include "Constants.h"
+
+
+/**
+ * ScalingResult Struct
+ * The cost of move generation, legality checking and search on one configuration (ChessBoard size, PieceLevel and filler density)
+ * - Times are the median of the repetitions, per call over the whole position (every pseudo legal move for the legality check)
+ * - A searchDepth of 0 means the search was not run
+ */
+struct ScalingResult final {
+    int numRowsOnBoard;
+    int numColsOnBoard;
+    PieceLevel pieceLevel;
+    double fillerDensity;
+    int numPieces = 0;
+    int numPseudoLegalMoves = 0;
+    int numLegalMoves = 0;
+    double pseudoLegalMoveGenerationNs = 0;
+    double legalityCheckNs = 0;
+    double legalMoveGenerationNs = 0;
+    int searchDepth = 0;
+    std::uint64_t numNodesSearched = 0;
+    double searchNs = 0;
+    double searchAllocations = 0;
+
+    explicit ScalingResult(int numRowsOnBoard, int numColsOnBoard, PieceLevel pieceLevel, double fillerDensity);
+    ScalingResult(ScalingResult const &other) = default;
+    ScalingResult(ScalingResult &&other) noexcept = default;
+    ScalingResult& operator=(ScalingResult const &other) = default;
+    ScalingResult& operator=(ScalingResult &&other) noexcept = default;
+    ~ScalingResult() = default;
+};
+
+
+#endif /* ScalingResult_h */
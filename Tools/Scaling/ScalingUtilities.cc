@@ -0,0 +1,170 @@
+// ScalingUtilities.cc
+
+#include "ScalingUtilities.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkResult.h"
+#include "BenchmarkUtilities.h"
+#include "BoardMove.h"
+#include "BoardSquare.h"
+#include "ChessBoard.h"
+#include "ChessBoardFactory.h"
+#include "ChessBoardUtilities.h"
+#include "Constants.h"
+#include "LevelFiveComputer.h"
+#include "MoveList.h"
+#include "PieceData.h"
+#include "ScalingResult.h"
+
+
+/*
+ * Returns a ChessBoard with the standard setup and random filler Pieces, Team one to move
+ * - ChessBoards too narrow for the standard setup start from a King per Team
+ * - fillerDensity is the number of fillers as a fraction of the squares on the ChessBoard, a filler is left out if the square it
+ *   picked is taken, it would put either King in check, or it is a Pawn on the first or last row
+ * - Fillers are drawn from a fixed seed per configuration, so every run measures the same positions
+ */
+std::unique_ptr<ChessBoard> ScalingUtilities::createScalingChessBoard(int numRowsOnBoard, int numColsOnBoard, PieceLevel pieceLevel, double fillerDensity) {
+    static std::vector<PieceType> const fillerPieceTypes = { PieceType::QUEEN, PieceType::ROOK, PieceType::BISHOP, PieceType::KNIGHT, PieceType::PAWN };
+
+    std::unique_ptr<ChessBoard> chessBoard = ChessBoardFactory::createChessBoard(numRowsOnBoard, numColsOnBoard);
+    Team teamOne = chessBoard->getTeamOne();
+    Team teamTwo = chessBoard->getTeamTwo();
+    if (!ChessBoardUtilities::applyStandardSetup(chessBoard, pieceLevel)) {
+        chessBoard->setPosition(BoardSquare(numRowsOnBoard - 1, numColsOnBoard / 2), PieceData(PieceType::KING, pieceLevel, teamOne, PieceDirection::NORTH, false));
+        chessBoard->setPosition(BoardSquare(0, numColsOnBoard / 2), PieceData(PieceType::KING, pieceLevel, teamTwo, PieceDirection::SOUTH, false));
+    }
+
+    // Fillers
+    std::mt19937 generator(static_cast<unsigned>(numRowsOnBoard * 1000 + numColsOnBoard) ^ static_cast<unsigned>(fillerDensity * 1000000) ^ (static_cast<unsigned>(pieceLevel) << 24));
+    std::uniform_int_distribution<int> rowDistribution(0, numRowsOnBoard - 1);
+    std::uniform_int_distribution<int> colDistribution(0, numColsOnBoard - 1);
+    std::uniform_int_distribution<int> pieceTypeDistribution(0, fillerPieceTypes.size() - 1);
+    int numFillers = static_cast<int>(std::lround(fillerDensity * numRowsOnBoard * numColsOnBoard));
+    for (int fillerIndex = 0; fillerIndex < numFillers; ++fillerIndex) {
+        BoardSquare boardSquare(rowDistribution(generator), colDistribution(generator));
+        PieceType pieceType = fillerPieceTypes[pieceTypeDistribution(generator)];
+        bool isTeamOne = fillerIndex % 2 == 0;
+        if (!chessBoard->isSquareEmpty(boardSquare) ||
+            (pieceType == PieceType::PAWN && (boardSquare.boardRow == 0 || boardSquare.boardRow == numRowsOnBoard - 1))) {
+            continue;
+        }
+
+        chessBoard->setPosition(boardSquare, PieceData(pieceType, pieceLevel, isTeamOne ? teamOne : teamTwo, isTeamOne ? PieceDirection::NORTH : PieceDirection::SOUTH, true));
+        if (chessBoard->isInCheck(teamOne) || chessBoard->isInCheck(teamTwo)) {
+            chessBoard->clearPosition(boardSquare);
+        }
+    }
+
+    chessBoard->setTeamToMove(teamOne);
+    return chessBoard;
+}
+
+/*
+ * Measures one configuration, for the Team to move
+ * - Pseudo legal move generation, the legality check of every pseudo legal move, and legal move generation
+ * - A LevelFiveComputer search to the searchDepth argument, with equally ranked moves left unshuffled so the node count is
+ *   reproducible, skipped when the searchDepth argument is 0 or there is no legal move
+ */
+ScalingResult ScalingUtilities::measureConfiguration(int numRowsOnBoard, int numColsOnBoard, PieceLevel pieceLevel, double fillerDensity, int searchDepth,
+                                                     int numRepetitions, std::chrono::nanoseconds minRepetitionTime) {
+    ScalingResult result(numRowsOnBoard, numColsOnBoard, pieceLevel, fillerDensity);
+    std::unique_ptr<ChessBoard> chessBoard = createScalingChessBoard(numRowsOnBoard, numColsOnBoard, pieceLevel, fillerDensity);
+    Team team = chessBoard->getTeamToMove();
+    std::string configuration = std::to_string(numRowsOnBoard) + "x" + std::to_string(numColsOnBoard);
+
+    MoveList pseudoLegalMoves;
+    MoveList legalMoves;
+    chessBoard->generateAllPseudoLegalMoves(team, pseudoLegalMoves);
+    chessBoard->generateAllLegalMoves(team, legalMoves);
+    result.numPieces = chessBoard->getPieceSquares(chessBoard->getTeamOne()).size() + chessBoard->getPieceSquares(chessBoard->getTeamTwo()).size();
+    result.numPseudoLegalMoves = pseudoLegalMoves.size();
+    result.numLegalMoves = legalMoves.size();
+
+    // Move generation and legality
+    volatile std::uint64_t sink = 0;        // Keeps the results of the operations alive
+    result.pseudoLegalMoveGenerationNs = BenchmarkUtilities::runBenchmark("pseudoLegalMoveGeneration", configuration, [&]() {
+        MoveList moves;
+        chessBoard->generateAllPseudoLegalMoves(team, moves);
+        sink = sink + moves.size();
+    }, numRepetitions, minRepetitionTime).medianNsPerOp;
+    result.legalityCheckNs = BenchmarkUtilities::runBenchmark("legalityCheck", configuration, [&]() {
+        int numLegalMoves = 0;
+        for (int moveIndex = 0; moveIndex < pseudoLegalMoves.size(); ++moveIndex) {
+            numLegalMoves += chessBoard->isPseudoLegalMoveLegal(pseudoLegalMoves[moveIndex]);
+        }
+        sink = sink + numLegalMoves;
+    }, numRepetitions, minRepetitionTime).medianNsPerOp;
+    result.legalMoveGenerationNs = BenchmarkUtilities::runBenchmark("legalMoveGeneration", configuration, [&]() {
+        MoveList moves;
+        chessBoard->generateAllLegalMoves(team, moves);
+        sink = sink + moves.size();
+    }, numRepetitions, minRepetitionTime).medianNsPerOp;
+
+    // Search
+    if (searchDepth > 0 && !legalMoves.empty()) {
+        LevelFiveComputer levelFiveComputer(team, searchDepth, false);
+        BenchmarkResult searchResult = BenchmarkUtilities::runBenchmark("search", configuration, [&]() {
+            sink = sink + levelFiveComputer.generateMove(chessBoard)->getToSquare().boardRow;
+            if (result.numNodesSearched == 0) {
+                result.numNodesSearched = levelFiveComputer.getNumNodesSearched();      // Every search visits the same nodes
+            }
+        }, numRepetitions, minRepetitionTime);
+        result.searchDepth = searchDepth;
+        result.searchNs = searchResult.medianNsPerOp;
+        result.searchAllocations = searchResult.allocationsPerOp;
+    }
+
+    return result;
+}
+
+/*
+ * Writes the results argument as CSV, one row per configuration
+ */
+void ScalingUtilities::printCsv(std::vector<ScalingResult> const &results, std::ostream &out) {
+    out << "rows,cols,piece_level,filler_density,pieces,pseudo_legal_moves,legal_moves,pseudo_legal_movegen_ns,legality_check_ns,"
+        << "legal_movegen_ns,search_depth,search_nodes,search_ns,search_ns_per_node,search_allocations" << std::endl;
+    for (ScalingResult const &result : results) {
+        out << result.numRowsOnBoard << "," << result.numColsOnBoard << "," << (result.pieceLevel == PieceLevel::BASIC ? "basic" : "advanced") << ","
+            << std::fixed << std::setprecision(3) << result.fillerDensity << "," << result.numPieces << "," << result.numPseudoLegalMoves << "," << result.numLegalMoves << ","
+            << std::setprecision(1) << result.pseudoLegalMoveGenerationNs << "," << result.legalityCheckNs << "," << result.legalMoveGenerationNs << ","
+            << result.searchDepth << "," << result.numNodesSearched << "," << result.searchNs << ","
+            << (result.numNodesSearched > 0 ? result.searchNs / result.numNodesSearched : 0.0) << "," << result.searchAllocations << std::endl;
+    }
+}
+
+/*
+ * Writes the results argument as a JSON document
+ */
+void ScalingUtilities::printJson(std::vector<ScalingResult> const &results, std::ostream &out) {
+    out << "{\n  \"configurations\": [";
+    for (int resultIndex = 0; resultIndex < static_cast<int>(results.size()); ++resultIndex) {
+        ScalingResult const &result = results[resultIndex];
+        out << (resultIndex == 0 ? "\n" : ",\n") << std::fixed
+            << "    { \"rows\": " << result.numRowsOnBoard
+            << ", \"cols\": " << result.numColsOnBoard
+            << ", \"piece_level\": \"" << (result.pieceLevel == PieceLevel::BASIC ? "basic" : "advanced") << "\""
+            << ", \"filler_density\": " << std::setprecision(3) << result.fillerDensity
+            << ", \"pieces\": " << result.numPieces
+            << ", \"pseudo_legal_moves\": " << result.numPseudoLegalMoves
+            << ", \"legal_moves\": " << result.numLegalMoves
+            << ", \"pseudo_legal_movegen_ns\": " << std::setprecision(1) << result.pseudoLegalMoveGenerationNs
+            << ", \"legality_check_ns\": " << result.legalityCheckNs
+            << ", \"legal_movegen_ns\": " << result.legalMoveGenerationNs
+            << ", \"search_depth\": " << result.searchDepth
+            << ", \"search_nodes\": " << result.numNodesSearched
+            << ", \"search_ns\": " << result.searchNs
+            << ", \"search_ns_per_node\": " << (result.numNodesSearched > 0 ? result.searchNs / result.numNodesSearched : 0.0)
+            << ", \"search_allocations\": " << result.searchAllocations << " }";
+    }
+    out << "\n  ]\n}" << std::endl;
+}
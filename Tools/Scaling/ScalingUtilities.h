@@ -0,0 +1,29 @@
+// ScalingUtilities.h
+
+#ifndef ScalingUtilities_h
+#define ScalingUtilities_h
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "ChessBoard.h"
+#include "Constants.h"
+#include "ScalingResult.h"
+
+
+/**
+ * Utility methods for measuring how the ChessBoard and the LevelFiveComputer scale with the size of the ChessBoard and the number of Pieces
+ */
+namespace ScalingUtilities {
+    std::unique_ptr<ChessBoard> createScalingChessBoard(int numRowsOnBoard, int numColsOnBoard, PieceLevel pieceLevel, double fillerDensity);
+    ScalingResult measureConfiguration(int numRowsOnBoard, int numColsOnBoard, PieceLevel pieceLevel, double fillerDensity, int searchDepth,
+                                       int numRepetitions, std::chrono::nanoseconds minRepetitionTime);
+
+    void printCsv(std::vector<ScalingResult> const &results, std::ostream &out);
+    void printJson(std::vector<ScalingResult> const &results, std::ostream &out);
+}
+
+
+#endif /* ScalingUtilities_h */
@@ -0,0 +1,125 @@
+// main.cc
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Constants.h"
+#include "ScalingResult.h"
+#include "ScalingUtilities.h"
+#include "Utilities.h"
+
+
+/*
+ * scaling [--sizes list] [--densities list] [--levels list] [--depth num] [--repetitions num] [--min-time-ms num] [--json]
+ * Measures move generation, legality checking and LevelFiveComputer search over a matrix of ChessBoard configurations
+ * - --sizes takes sizes such as 8 (8x8) or 10x14, within the 4x4 to 26x26 allowed by the game
+ * - --densities takes the number of random filler Pieces added to the standard setup, as a fraction of the squares
+ * - --depth 0 skips the search
+ * - Writes CSV to standard output, or JSON with --json, and the progress to standard error
+ */
+int main(int argc, char *argv[]) {
+    static std::regex const sizeRegex("^([0-9]+)(?:x([0-9]+))?$");
+
+    std::vector<std::pair<int, int>> sizes = { {4, 4}, {8, 8}, {12, 12}, {16, 16}, {20, 20}, {26, 26} };
+    std::vector<double> fillerDensities = { 0.0, 0.1, 0.25 };
+    std::vector<PieceLevel> pieceLevels = { PieceLevel::BASIC, PieceLevel::ADVANCED };
+    int searchDepth = 2;
+    int numRepetitions = 3;
+    int minRepetitionTimeMs = 10;
+    bool shouldPrintJson = false;
+
+    auto splitList = [](std::string const &listStr) {
+        std::vector<std::string> itemStrs;
+        std::istringstream listStream(listStr);
+        for (std::string itemStr; std::getline(listStream, itemStr, ',');) {
+            itemStrs.push_back(itemStr);
+        }
+        return itemStrs;
+    };
+    auto reportIllegalArgument = [](std::string const &arg) {
+        std::cerr << "Illegal argument " << arg << std::endl;
+        return 2;
+    };
+
+    // Arguments
+    for (int argIndex = 1; argIndex < argc; ++argIndex) {
+        std::string arg = argv[argIndex];
+        if (arg == "--json") {
+            shouldPrintJson = true;
+            continue;
+        } else if (argIndex + 1 >= argc) {
+            return reportIllegalArgument(arg);
+        }
+
+        std::string valueStr = argv[++argIndex];
+        if (arg == "--sizes") {
+            sizes.clear();
+            for (std::string const &sizeStr : splitList(valueStr)) {
+                std::smatch matches;
+                if (!std::regex_match(sizeStr, matches, sizeRegex)) {
+                    return reportIllegalArgument(sizeStr);
+                }
+                int numRowsOnBoard = std::stoi(matches[1]);
+                int numColsOnBoard = matches[2].matched ? std::stoi(matches[2]) : numRowsOnBoard;
+                if (numRowsOnBoard < 4 || numRowsOnBoard > 26 || numColsOnBoard < 4 || numColsOnBoard > 26) {
+                    return reportIllegalArgument(sizeStr);
+                }
+                sizes.emplace_back(numRowsOnBoard, numColsOnBoard);
+            }
+        } else if (arg == "--densities") {
+            fillerDensities.clear();
+            for (std::string const &densityStr : splitList(valueStr)) {
+                double fillerDensity = std::atof(densityStr.c_str());
+                if (fillerDensity < 0 || fillerDensity > 1) {
+                    return reportIllegalArgument(densityStr);
+                }
+                fillerDensities.push_back(fillerDensity);
+            }
+        } else if (arg == "--levels") {
+            pieceLevels.clear();
+            for (std::string const &levelStr : splitList(valueStr)) {
+                std::optional<PieceLevel> pieceLevel = Utilities::stringToPieceLevel(levelStr);
+                if (!pieceLevel.has_value()) {
+                    return reportIllegalArgument(levelStr);
+                }
+                pieceLevels.push_back(pieceLevel.value());
+            }
+        } else if (arg == "--depth") {
+            searchDepth = std::max(0, std::atoi(valueStr.c_str()));
+        } else if (arg == "--repetitions") {
+            numRepetitions = std::max(1, std::atoi(valueStr.c_str()));
+        } else if (arg == "--min-time-ms") {
+            minRepetitionTimeMs = std::max(1, std::atoi(valueStr.c_str()));
+        } else {
+            return reportIllegalArgument(arg);
+        }
+    }
+
+    // Measure
+    std::vector<ScalingResult> results;
+    for (std::pair<int, int> const &size : sizes) {
+        for (PieceLevel pieceLevel : pieceLevels) {
+            for (double fillerDensity : fillerDensities) {
+                std::cerr << size.first << "x" << size.second << " " << (pieceLevel == PieceLevel::BASIC ? "basic" : "advanced") << " " << fillerDensity << std::endl;
+                results.push_back(ScalingUtilities::measureConfiguration(size.first, size.second, pieceLevel, fillerDensity, searchDepth,
+                                                                        numRepetitions, std::chrono::milliseconds(minRepetitionTimeMs)));
+            }
+        }
+    }
+
+    // Report
+    if (shouldPrintJson) {
+        ScalingUtilities::printJson(results, std::cout);
+    } else {
+        ScalingUtilities::printCsv(results, std::cout);
+    }
+    return 0;
+}
@@ -1,11 +1,30 @@
 // main.cc
 
+#include <cstdlib>
 #include <iostream>
+#include <string>
 
+#include "BenchWrapper.h"
 #include "GameWrapper.h"
 
 
-int main () {
+/*
+ * chess                        Plays a game, reading commands from standard input
+ * chess bench [depth] [threads] Runs the LevelFiveComputer search over the bench positions
+ */
+int main(int argc, char *argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "bench") {
+        int searchDepth = argc > 2 ? std::atoi(argv[2]) : BenchWrapper::defaultSearchDepth;
+        int numThreads = argc > 3 ? std::atoi(argv[3]) : 1;
+        if (searchDepth <= 0 || numThreads <= 0 || argc > 4) {
+            std::cerr << "Usage: " << argv[0] << " bench [depth] [threads]" << std::endl;
+            return 2;
+        }
+        BenchWrapper benchWrapper(std::cout, searchDepth, numThreads);
+        benchWrapper.runBench();
+        return 0;
+    }
+
     GameWrapper gameWrapper(std::cin, std::cout, std::cout);
     gameWrapper.runGame();
 }